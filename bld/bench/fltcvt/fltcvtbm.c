@@ -0,0 +1,214 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Benchmark program that writes tens of millions of doubles
+*               as text and reads them back, checking that every one
+*               reads back as the value written.
+*
+****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "timer.h"
+#include "report.h"
+
+#define FILE_NAME   "fltcvtbm.tmp"
+#define COUNT       10000000L       /* Values written and read each test. */
+
+typedef long write_fn( FILE *fp );
+typedef long read_fn( FILE *fp, long *bad );
+
+/*
+ * The values come from a simple generator so that the readers can make
+ * them again to check against. Half have 53 random bits and exponents
+ * within 2^-100..2^100, half look like measured data, a number of
+ * modest size with three decimal places.
+ */
+static unsigned long    seed;
+
+static unsigned long next_rand( void )
+{
+    seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return( seed );
+}
+
+static double next_value( void )
+{
+    unsigned long   hi;
+    unsigned long   lo;
+
+    hi = next_rand();
+    lo = next_rand();
+    if( hi & 1 ) {
+        return( (double)(lo % 100000000UL) / 1000.0 );
+    }
+    return( ldexp( (double)(hi >> 11) * 4294967296.0 + (double)lo,
+                   (int)(next_rand() % 201) - 100 - 53 ) );
+}
+
+static long write_17g( FILE *fp )
+{
+    long    i;
+
+    for( i = 0; i < COUNT; ++i ) {
+        fprintf( fp, "%.17g\n", next_value() );
+    }
+    return( i );
+}
+
+static long write_15g( FILE *fp )
+{
+    long    i;
+
+    for( i = 0; i < COUNT; ++i ) {
+        fprintf( fp, "%.15g\n", next_value() );
+    }
+    return( i );
+}
+
+static long write_6e( FILE *fp )
+{
+    long    i;
+
+    for( i = 0; i < COUNT; ++i ) {
+        fprintf( fp, "%.6e\n", next_value() );
+    }
+    return( i );
+}
+
+static long write_f( FILE *fp )
+{
+    long    i;
+
+    for( i = 0; i < COUNT; ++i ) {
+        fprintf( fp, "%f\n", next_value() );
+    }
+    return( i );
+}
+
+static long read_strtod( FILE *fp, long *bad )
+{
+    char    line[64];
+    long    n;
+
+    for( n = 0; fgets( line, sizeof( line ), fp ) != NULL; ++n ) {
+        if( strtod( line, NULL ) != next_value() ) {
+            ++*bad;
+        }
+    }
+    return( n );
+}
+
+static long read_fscanf( FILE *fp, long *bad )
+{
+    double  x;
+    long    n;
+
+    for( n = 0; fscanf( fp, "%lf", &x ) == 1; ++n ) {
+        if( x != next_value() ) {
+            ++*bad;
+        }
+    }
+    return( n );
+}
+
+static struct test {
+    char        *name;
+    write_fn    *writer;
+    read_fn     *reader;        /* NULL if the text doesn't round-trip */
+} tests[] = {
+    { "%.17g",  write_17g,  read_strtod },
+    { "%.17g",  write_17g,  read_fscanf },
+    { "%.15g",  write_15g,  NULL },
+    { "%.6e",   write_6e,   NULL },
+    { "%f",     write_f,    NULL },
+};
+
+static FILE *open_file( char *mode )
+{
+    FILE    *fp;
+
+    fp = fopen( FILE_NAME, mode );
+    if( fp == NULL ) {
+        printf( "Unable to open %s\n", FILE_NAME );
+        exit( EXIT_FAILURE );
+    }
+    return( fp );
+}
+
+static void check( char *what, long n )
+{
+    if( n != COUNT ) {
+        printf( "%s: %ld values, expected %ld\n", what, n, COUNT );
+        exit( EXIT_FAILURE );
+    }
+}
+
+int main( void )
+{
+    char        name[80];
+    struct test *t;
+    FILE        *fp;
+    double      elapsed;
+    long        bad;
+    int         i;
+
+    printf( "Format        write     read  misread\n" );
+    for( i = 0; i < sizeof( tests ) / sizeof( tests[0] ); ++i ) {
+        t = &tests[i];
+        fp = open_file( "w" );
+        seed = 1;
+        TimerOn();
+        check( t->name, t->writer( fp ) );
+        fclose( fp );
+        TimerOff();
+        elapsed = TimerElapsed();
+        printf( "%-8s %10.3f", t->name, elapsed );
+        sprintf( name, "fltcvt write %s", t->name );
+        Report( name, elapsed );
+        if( t->reader != NULL ) {
+            fp = open_file( "r" );
+            seed = 1;
+            bad = 0;
+            TimerOn();
+            check( t->name, t->reader( fp, &bad ) );
+            fclose( fp );
+            TimerOff();
+            elapsed = TimerElapsed();
+            printf( " %8.3f %8ld", elapsed, bad );
+            sprintf( name, "fltcvt read %s %s", t->name,
+                     t->reader == read_strtod ? "strtod" : "fscanf" );
+            Report( name, elapsed );
+        }
+        printf( "\n" );
+    }
+
+    remove( FILE_NAME );
+    return( EXIT_SUCCESS );
+}
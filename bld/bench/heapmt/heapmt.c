@@ -0,0 +1,123 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Benchmark program that times malloc() and free() from
+*               1 to 64 threads doing the same total amount of work.
+*
+****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <process.h>
+#include <windows.h>
+#include "timer.h"
+#include "report.h"
+
+#define TOTAL_OPS   6400000L    /* malloc/free pairs, split over threads */
+#define SLOTS       512         /* blocks each thread keeps live         */
+#define MAX_SIZE    256         /* largest block requested               */
+#define MAX_THREADS 64          /* WaitForMultipleObjects limit          */
+
+static long     ops_per_thread;
+
+/* Keep a window of live blocks and replace a random one each step. Every
+   fourth block goes to a shared array and is freed by whichever thread
+   picks it up next, so some frees happen away from the allocating
+   thread. */
+static void * volatile  shared[SLOTS];
+
+static unsigned __stdcall worker( void *arg )
+{
+    void        *slot[SLOTS];
+    void        *p;
+    unsigned    seed;
+    unsigned    i;
+    long        n;
+
+    seed = (unsigned)arg * 2654435761U;
+    for( i = 0; i < SLOTS; ++i ) {
+        slot[i] = NULL;
+    }
+    for( n = ops_per_thread; n > 0; --n ) {
+        seed = seed * 1103515245U + 12345U;
+        i = ( seed >> 8 ) % SLOTS;
+        p = malloc( 1 + ( seed >> 20 ) % MAX_SIZE );
+        if( p == NULL ) {
+            printf( "Out of memory\n" );
+            exit( EXIT_FAILURE );
+        }
+        *(char *)p = 0;
+        if( ( seed & 0x300 ) == 0 ) {
+            p = (void *)InterlockedExchange( (LPLONG)&shared[i], (LONG)p );
+        } else {
+            void *q = slot[i];
+            slot[i] = p;
+            p = q;
+        }
+        free( p );
+    }
+    for( i = 0; i < SLOTS; ++i ) {
+        free( slot[i] );
+    }
+    return( 0 );
+}
+
+int main( void )
+{
+    HANDLE      threads[MAX_THREADS];
+    unsigned    id;
+    char        name[80];
+    double      elapsed;
+    int         count;
+    int         i;
+
+    printf( "Threads    Time\n" );
+    for( count = 1; count <= MAX_THREADS; count *= 2 ) {
+        ops_per_thread = TOTAL_OPS / count;
+        TimerOn();
+        for( i = 0; i < count; ++i ) {
+            threads[i] = (HANDLE)_beginthreadex( NULL, 0, worker, (void *)(i + 1), 0, &id );
+            if( threads[i] == 0 ) {
+                printf( "Unable to create thread\n" );
+                return( EXIT_FAILURE );
+            }
+        }
+        WaitForMultipleObjects( count, threads, TRUE, INFINITE );
+        TimerOff();
+        for( i = 0; i < count; ++i ) {
+            CloseHandle( threads[i] );
+        }
+        elapsed = TimerElapsed();
+        printf( "%7d %8.3f\n", count, elapsed );
+        sprintf( name, "heapmt %d threads", count );
+        Report( name, elapsed );
+    }
+    for( i = 0; i < SLOTS; ++i ) {
+        free( shared[i] );
+    }
+    return( EXIT_SUCCESS );
+}
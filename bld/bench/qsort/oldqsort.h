@@ -0,0 +1,3 @@
+/* The previous C library qsort(), for comparison. */
+extern void old_qsort( void *base, size_t n, size_t size,
+                       int (*compar)( const void *, const void * ) );
@@ -0,0 +1,136 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Benchmark program that times the C library qsort() against
+*               the previous implementation on records of several sizes
+*               and on inputs that are hard for a plain quicksort.
+*
+****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "timer.h"
+#include "report.h"
+#include "oldqsort.h"
+
+#define N           100000      /* Number of records to sort.             */
+#define TEST_COUNT  10          /* Number of times each array is sorted.  */
+
+typedef void sort_fn( void *, size_t, size_t, int (*)( const void *, const void * ) );
+
+static char *holding;
+static char *working;
+
+/* The key is the first long of each record; copy it out in case the
+   record size leaves it unaligned. */
+static int key_compare( const void *left, const void *right )
+{
+    long    x;
+    long    y;
+
+    memcpy( &x, left, sizeof( long ) );
+    memcpy( &y, right, sizeof( long ) );
+    if( x < y ) return( -1 );
+    if( x > y ) return( +1 );
+    return( 0 );
+}
+
+static long make_key( int shape, long i )
+{
+    switch( shape ) {
+    case 0:  return( rand() );                          /* random     */
+    case 1:  return( i );                               /* sorted     */
+    case 2:  return( N - i );                           /* reverse    */
+    case 3:  return( ( i < N/2 ) ? i : N - i );         /* organ pipe */
+    default: return( rand() % 8 );                      /* duplicates */
+    }
+}
+
+static char *shape_names[] = {
+    "random", "sorted", "reverse", "organ pipe", "duplicates"
+};
+
+static void fill( int shape, size_t size )
+{
+    long    i;
+    long    key;
+
+    srand( 0 );
+    memset( holding, 0, N * size );
+    for( i = 0; i < N; ++i ) {
+        key = make_key( shape, i );
+        memcpy( holding + i * size, &key, sizeof( long ) );
+    }
+}
+
+static double time_sort( sort_fn *sort, size_t size )
+{
+    int     i;
+
+    TimerOn();
+    for( i = 0; i < TEST_COUNT; ++i ) {
+        memcpy( working, holding, N * size );
+        sort( working, N, size, key_compare );
+    }
+    TimerOff();
+    return( TimerElapsed() );
+}
+
+int main( void )
+{
+    static size_t   sizes[] = { sizeof( long ), 8, 16, 7 };
+    char            name[80];
+    double          new_time;
+    double          old_time;
+    int             shape;
+    int             i;
+
+    holding = malloc( N * 16 );
+    working = malloc( N * 16 );
+    if( holding == NULL || working == NULL ) {
+        printf( "Out of memory\n" );
+        return( EXIT_FAILURE );
+    }
+
+    printf( "Size  Input          qsort    old_qsort\n" );
+    for( i = 0; i < sizeof( sizes ) / sizeof( sizes[0] ); ++i ) {
+        for( shape = 0; shape < sizeof( shape_names ) / sizeof( shape_names[0] ); ++shape ) {
+            fill( shape, sizes[i] );
+            new_time = time_sort( (sort_fn *)qsort, sizes[i] );
+            old_time = time_sort( old_qsort, sizes[i] );
+            printf( "%4u  %-12s %8.3f  %8.3f\n",
+                    (unsigned)sizes[i], shape_names[shape], new_time, old_time );
+            sprintf( name, "qsort %u %s", (unsigned)sizes[i], shape_names[shape] );
+            Report( name, new_time );
+        }
+    }
+
+    free( working );
+    free( holding );
+    return( EXIT_SUCCESS );
+}
@@ -0,0 +1,232 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Benchmark program for the small if/else assignments
+*               (min, max, clamp, select) that the code generator turns
+*               into branch-free code.
+*
+****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "timer.h"
+#include "report.h"
+
+#define SIZE        4096            /* Elements in each array. */
+#define PASSES      5000            /* Times each kernel walks them. */
+
+typedef long kernel_fn( int *a, int *b, int n );
+
+/*
+ * Every kernel runs over the same data twice: once in random order and
+ * once sorted. A branch predicts the sorted data almost perfectly and
+ * the random data about half the time, so with branches the random run
+ * is several times slower. Branch-free code takes the same time on both.
+ */
+static unsigned long    seed;
+
+static unsigned long next_rand( void )
+{
+    seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return( seed >> 8 );
+}
+
+static long k_max( int *a, int *b, int n )
+{
+    int     i;
+    int     m;
+
+    m = a[0];
+    for( i = 1; i < n; ++i ) {
+        if( a[i] > m ) {
+            m = a[i];
+        }
+    }
+    b = b;
+    return( m );
+}
+
+static long k_min2( int *a, int *b, int n )
+{
+    int     i;
+    int     x;
+    long    sum;
+
+    sum = 0;
+    for( i = 0; i < n; ++i ) {
+        x = a[i];
+        if( b[i] < x ) {
+            x = b[i];
+        }
+        sum += x;
+    }
+    return( sum );
+}
+
+static long k_clamp( int *a, int *b, int n )
+{
+    int     i;
+    int     x;
+
+    for( i = 0; i < n; ++i ) {
+        x = a[i];
+        if( x < 256 ) {
+            x = 256;
+        }
+        if( x > 768 ) {
+            x = 768;
+        }
+        b[i] = x;
+    }
+    return( b[n - 1] );
+}
+
+static long k_count( int *a, int *b, int n )
+{
+    int     i;
+    int     x;
+    long    sum;
+
+    sum = 0;
+    for( i = 0; i < n; ++i ) {
+        if( a[i] < 512 ) {
+            x = 3;
+        } else {
+            x = 10;
+        }
+        sum += x;
+    }
+    b = b;
+    return( sum );
+}
+
+static long k_select( int *a, int *b, int n )
+{
+    int     i;
+    int     x;
+    int     lo;
+    int     hi;
+    long    sum;
+
+    sum = 0;
+    for( i = 0; i < n; ++i ) {
+        lo = a[i];
+        hi = b[i];
+        if( a[i] & 1 ) {
+            x = lo;
+        } else {
+            x = hi;
+        }
+        sum += x;
+    }
+    return( sum );
+}
+
+static struct test {
+    char        *name;
+    kernel_fn   *kernel;
+} tests[] = {
+    { "max",    k_max },
+    { "min",    k_min2 },
+    { "clamp",  k_clamp },
+    { "count",  k_count },
+    { "select", k_select },
+};
+
+static int  data_a[SIZE];
+static int  data_b[SIZE];
+static int  work[SIZE];
+
+static int compare( const void *p1, const void *p2 )
+{
+    return( *(const int *)p1 - *(const int *)p2 );
+}
+
+static void fill( int sorted )
+{
+    int     i;
+
+    seed = 1;
+    for( i = 0; i < SIZE; ++i ) {
+        data_a[i] = (int)(next_rand() % 1024);
+        data_b[i] = (int)(next_rand() % 1024);
+    }
+    if( sorted ) {
+        qsort( data_a, SIZE, sizeof( int ), compare );
+        qsort( data_b, SIZE, sizeof( int ), compare );
+    }
+}
+
+static double run( struct test *t, long *result )
+{
+    long    check;
+    int     pass;
+    int     i;
+
+    check = 0;
+    TimerOn();
+    for( pass = 0; pass < PASSES; ++pass ) {
+        for( i = 0; i < SIZE; ++i ) {
+            work[i] = data_b[i];
+        }
+        check += t->kernel( data_a, work, SIZE );
+    }
+    TimerOff();
+    *result = check;
+    return( TimerElapsed() );
+}
+
+int main( void )
+{
+    char        name[80];
+    struct test *t;
+    double      random_time;
+    double      sorted_time;
+    long        random_check;
+    long        sorted_check;
+    int         i;
+
+    printf( "Kernel      random   sorted    ratio\n" );
+    for( i = 0; i < sizeof( tests ) / sizeof( tests[0] ); ++i ) {
+        t = &tests[i];
+        fill( 0 );
+        random_time = run( t, &random_check );
+        fill( 1 );
+        sorted_time = run( t, &sorted_check );
+        printf( "%-8s %9.3f %8.3f %8.2f\n", t->name, random_time,
+                sorted_time, random_time / sorted_time );
+        sprintf( name, "select %s random", t->name );
+        Report( name, random_time );
+        sprintf( name, "select %s sorted", t->name );
+        Report( name, sorted_time );
+        if( random_check == 0 || sorted_check == 0 ) {
+            printf( "%s: no result\n", t->name );
+            return( EXIT_FAILURE );
+        }
+    }
+    return( EXIT_SUCCESS );
+}
@@ -0,0 +1,227 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Benchmark program that times stream input and output one
+*               character at a time, with and without locking, and in
+*               small and large blocks through several buffer sizes.
+*
+****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "timer.h"
+#include "report.h"
+
+#if defined( _MSC_VER )
+    #define getc_unlocked( fp )             _getc_nolock( fp )
+    #define putc_unlocked( c, fp )          _putc_nolock( c, fp )
+    #define fread_unlocked( p, s, n, fp )   _fread_nolock( p, s, n, fp )
+    #define fwrite_unlocked( p, s, n, fp )  _fwrite_nolock( p, s, n, fp )
+#endif
+
+#define FILE_NAME   "stdiobm.tmp"
+#define FILE_SIZE   (16L*1024*1024) /* Bytes written and read each test.  */
+#define RECORD      16              /* Small block size.                  */
+#define BLOCK       (1024*1024)     /* Large block size.                  */
+
+typedef long io_fn( FILE *fp );
+
+static char *block;
+
+static long write_fputc( FILE *fp )
+{
+    long    i;
+
+    for( i = 0; i < FILE_SIZE; ++i ) {
+        fputc( (char)i, fp );
+    }
+    return( i );
+}
+
+static long write_putc_unlocked( FILE *fp )
+{
+    long    i;
+
+    for( i = 0; i < FILE_SIZE; ++i ) {
+        putc_unlocked( (char)i, fp );
+    }
+    return( i );
+}
+
+static long write_small( FILE *fp )
+{
+    long    i;
+
+    for( i = 0; i < FILE_SIZE; i += RECORD ) {
+        fwrite( block, 1, RECORD, fp );
+    }
+    return( i );
+}
+
+static long write_small_unlocked( FILE *fp )
+{
+    long    i;
+
+    for( i = 0; i < FILE_SIZE; i += RECORD ) {
+        fwrite_unlocked( block, 1, RECORD, fp );
+    }
+    return( i );
+}
+
+static long write_large( FILE *fp )
+{
+    long    i;
+
+    for( i = 0; i < FILE_SIZE; i += BLOCK ) {
+        fwrite( block, 1, BLOCK, fp );
+    }
+    return( i );
+}
+
+static long read_fgetc( FILE *fp )
+{
+    long    n;
+
+    for( n = 0; fgetc( fp ) != EOF; ++n )
+        ;
+    return( n );
+}
+
+static long read_getc_unlocked( FILE *fp )
+{
+    long    n;
+
+    for( n = 0; getc_unlocked( fp ) != EOF; ++n )
+        ;
+    return( n );
+}
+
+static long read_small( FILE *fp )
+{
+    long    n;
+
+    for( n = 0; fread( block, 1, RECORD, fp ) == RECORD; n += RECORD )
+        ;
+    return( n );
+}
+
+static long read_small_unlocked( FILE *fp )
+{
+    long    n;
+
+    for( n = 0; fread_unlocked( block, 1, RECORD, fp ) == RECORD; n += RECORD )
+        ;
+    return( n );
+}
+
+static long read_large( FILE *fp )
+{
+    long    n;
+    size_t  got;
+
+    for( n = 0; (got = fread( block, 1, BLOCK, fp )) != 0; n += got )
+        ;
+    return( n );
+}
+
+static struct test {
+    char    *name;
+    char    *mode;
+    io_fn   *fn;
+} tests[] = {
+    { "fputc",              "wb", write_fputc },
+    { "putc_unlocked",      "wb", write_putc_unlocked },
+    { "fwrite 16",          "wb", write_small },
+    { "fwrite_unlocked 16", "wb", write_small_unlocked },
+    { "fwrite 1M",          "wb", write_large },
+    { "fgetc",              "rb", read_fgetc },
+    { "getc_unlocked",      "rb", read_getc_unlocked },
+    { "fread 16",           "rb", read_small },
+    { "fread_unlocked 16",  "rb", read_small_unlocked },
+    { "fread 1M",           "rb", read_large },
+};
+
+/* Zero means the library's own choice of buffer size. */
+static size_t buf_sizes[] = { 0, 512, 4096, 65536 };
+
+static double run( struct test *t, size_t buf_size )
+{
+    FILE    *fp;
+    long    n;
+
+    fp = fopen( FILE_NAME, t->mode );
+    if( fp == NULL ) {
+        printf( "Unable to open %s\n", FILE_NAME );
+        exit( EXIT_FAILURE );
+    }
+    if( buf_size != 0 ) {
+        setvbuf( fp, NULL, _IOFBF, buf_size );
+    }
+    TimerOn();
+    n = t->fn( fp );
+    fclose( fp );
+    TimerOff();
+    if( n != FILE_SIZE ) {
+        printf( "%s: transferred %ld bytes, expected %ld\n", t->name, n, FILE_SIZE );
+        exit( EXIT_FAILURE );
+    }
+    return( TimerElapsed() );
+}
+
+int main( void )
+{
+    char        name[80];
+    double      elapsed;
+    int         i;
+    int         j;
+
+    block = malloc( BLOCK );
+    if( block == NULL ) {
+        printf( "Out of memory\n" );
+        return( EXIT_FAILURE );
+    }
+    memset( block, 'x', BLOCK );
+
+    printf( "Test                   default      512     4096    65536\n" );
+    for( i = 0; i < sizeof( tests ) / sizeof( tests[0] ); ++i ) {
+        printf( "%-20s", tests[i].name );
+        for( j = 0; j < sizeof( buf_sizes ) / sizeof( buf_sizes[0] ); ++j ) {
+            elapsed = run( &tests[i], buf_sizes[j] );
+            printf( " %8.3f", elapsed );
+            if( buf_sizes[j] == 0 ) {
+                sprintf( name, "stdio %s", tests[i].name );
+                Report( name, elapsed );
+            }
+        }
+        printf( "\n" );
+    }
+
+    remove( FILE_NAME );
+    free( block );
+    return( EXIT_SUCCESS );
+}
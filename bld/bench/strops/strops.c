@@ -0,0 +1,150 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Benchmark program that times strlen(), memchr(), memcpy()
+*               and memset() on short and long, aligned and misaligned
+*               buffers.
+*
+****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "timer.h"
+#include "report.h"
+
+#define BUF_SIZE    65536       /* Size of each buffer.                   */
+#define WORK        100000000L  /* Bytes processed per test.              */
+
+static char *src;
+static char *dst;
+
+/* Defeat the optimizer so each call really happens. */
+volatile size_t sink;
+
+static double time_strlen( size_t len, unsigned offset )
+{
+    long    count;
+
+    memset( src, 'x', BUF_SIZE );
+    src[offset + len] = '\0';
+    TimerOn();
+    for( count = WORK / ( len + 1 ); count > 0; --count ) {
+        sink += strlen( src + offset );
+    }
+    TimerOff();
+    return( TimerElapsed() );
+}
+
+static double time_memchr( size_t len, unsigned offset )
+{
+    long    count;
+
+    memset( src, 'x', BUF_SIZE );
+    src[offset + len - 1] = 'y';
+    TimerOn();
+    for( count = WORK / len; count > 0; --count ) {
+        sink += (char *)memchr( src + offset, 'y', len ) - src;
+    }
+    TimerOff();
+    return( TimerElapsed() );
+}
+
+static double time_memcpy( size_t len, unsigned offset )
+{
+    long    count;
+
+    TimerOn();
+    for( count = WORK / len; count > 0; --count ) {
+        memcpy( dst + offset, src + offset, len );
+    }
+    TimerOff();
+    sink += dst[offset];
+    return( TimerElapsed() );
+}
+
+static double time_memset( size_t len, unsigned offset )
+{
+    long    count;
+
+    TimerOn();
+    for( count = WORK / len; count > 0; --count ) {
+        memset( dst + offset, (int)count, len );
+    }
+    TimerOff();
+    sink += dst[offset];
+    return( TimerElapsed() );
+}
+
+typedef double test_fn( size_t, unsigned );
+
+static struct {
+    char        *name;
+    test_fn     *fn;
+} tests[] = {
+    { "strlen", time_strlen },
+    { "memchr", time_memchr },
+    { "memcpy", time_memcpy },
+    { "memset", time_memset },
+};
+
+int main( void )
+{
+    static size_t   lengths[] = { 7, 64, 1000, 60000 };
+    static unsigned offsets[] = { 0, 3 };
+    char            name[80];
+    double          elapsed;
+    int             t;
+    int             i;
+    int             j;
+
+    src = malloc( BUF_SIZE + 16 );
+    dst = malloc( BUF_SIZE + 16 );
+    if( src == NULL || dst == NULL ) {
+        printf( "Out of memory\n" );
+        return( EXIT_FAILURE );
+    }
+    memset( dst, 0, BUF_SIZE + 16 );
+
+    printf( "Function  Length  Offset   Time\n" );
+    for( t = 0; t < sizeof( tests ) / sizeof( tests[0] ); ++t ) {
+        for( i = 0; i < sizeof( lengths ) / sizeof( lengths[0] ); ++i ) {
+            for( j = 0; j < sizeof( offsets ) / sizeof( offsets[0] ); ++j ) {
+                elapsed = tests[t].fn( lengths[i], offsets[j] );
+                printf( "%-8s %7u %7u %8.3f\n", tests[t].name,
+                        (unsigned)lengths[i], offsets[j], elapsed );
+                sprintf( name, "%s %u+%u", tests[t].name,
+                         (unsigned)lengths[i], offsets[j] );
+                Report( name, elapsed );
+            }
+        }
+    }
+
+    free( dst );
+    free( src );
+    return( EXIT_SUCCESS );
+}
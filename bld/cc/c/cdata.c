@@ -102,6 +102,8 @@ void InitGlobalVars( void )
     SymSTOD                 = 0;    /* builtin symbol for 'rep stosd' */
     SymSTOSB                = 0;    /* builtin symbol for '__STOSB' */
     SymSTOSD                = 0;    /* builtin symbol for '__STOSD' */
+    SymMEMSET               = 0;    /* builtin symbol for inline 'memset' */
+    SymMEMCPY               = 0;    /* builtin symbol for inline 'memcpy' */
 #endif
 #ifdef __SEH__
     SymTryInit              = 0;    /* builtin symbol for '__TryInit' */
@@ -224,6 +226,7 @@ void InitGlobalVars( void )
     InitialMacroFlag        = MFLAG_NONE;
     Stack87                 = 0;
     ErrorFileName           = NULL;
+    ProfileFileName         = NULL;
 
     UndefNames              = NULL;
 
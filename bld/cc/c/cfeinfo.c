@@ -1113,6 +1113,8 @@ VOIDPTR FEAuxInfo( CGSYM_HANDLE cgsym_handle, int request )
     case P5_PROF_SEG:
         return( (VOIDPTR)FunctionProfileSegment );
   #endif
+    case PROFILE_NAME:
+        return( ProfileFileName );
     case SOURCE_NAME:
         if( SrcFName == ModuleName ) {
             return( FNameFullPath( FNames ) );
@@ -1360,6 +1362,8 @@ VOIDPTR FEAuxInfo( CGSYM_HANDLE cgsym_handle, int request )
         return( (VOIDPTR)II_REVISION );
     case AUX_LOOKUP:
         return( (VOIDPTR)sym_handle );
+    case PROFILE_NAME:
+        return( ProfileFileName );
     case SOURCE_NAME:
         if( SrcFName == ModuleName ) {
             return( FNameFullPath( FNames ) );
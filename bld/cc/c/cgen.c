@@ -1352,6 +1352,246 @@ local void PruneFunctions( void )
     }
 }
 
+/* Interprocedural constant propagation within the module. A static
+   function whose address is never taken can only be reached through
+   the calls in this file. When all of them pass the same integer
+   constant for a parameter that the function never assigns to or takes
+   the address of, the uses of the parameter are replaced by the
+   constant so that the code generator can fold it. The calls still
+   pass the argument.
+*/
+#define MAX_CONST_PARMS 8
+
+typedef enum {
+    PARM_UNSEEN,
+    PARM_CONST,
+    PARM_VARYING
+} parm_state;
+
+typedef struct const_func {
+    struct const_func   *next;
+    SYM_HANDLE          sym_handle;
+    int                 parm_count;
+    struct const_parm {
+        SYM_HANDLE      sym_handle;
+        DATA_TYPE       const_type;
+        parm_state      state;
+        unsigned long   value;
+    }                   parm[ MAX_CONST_PARMS ];
+} const_func;
+
+local DATA_TYPE ConstParmType( TYPEPTR typ )
+{
+    SKIP_TYPEDEFS( typ );
+    switch( typ->decl_type ) {
+    case TYPE_CHAR:
+    case TYPE_UCHAR:
+    case TYPE_SHORT:
+    case TYPE_USHORT:
+    case TYPE_INT:
+    case TYPE_UINT:
+    case TYPE_LONG:
+    case TYPE_ULONG:
+        return( typ->decl_type );
+    default:
+        return( TYPE_VOID );
+    }
+}
+
+local const_func *NewConstFunc( SYM_HANDLE func_handle )
+{
+    SYM_ENTRY   sym;
+    SYMPTR      parm;
+    SYM_HANDLE  parm_handle;
+    TYPEPTR     typ;
+    const_func  *func;
+    int         i;
+
+    SymGet( &sym, func_handle );
+    if( sym.stg_class != SC_STATIC || ( sym.flags & SYM_ADDR_TAKEN ) )
+        return( NULL );
+    typ = sym.sym_type;
+    SKIP_TYPEDEFS( typ );
+    if( typ->u.fn.parms == NULL || sym.u.func.parms == 0 )
+        return( NULL );
+    func = CMemAlloc( sizeof( const_func ) );
+    func->sym_handle = func_handle;
+    i = 0;
+    for( parm_handle = sym.u.func.parms; parm_handle; parm_handle = parm->handle ) {
+        parm = SymGetPtr( parm_handle );
+        if( i == MAX_CONST_PARMS || parm->sym_type->decl_type == TYPE_DOT_DOT_DOT ) {
+            CMemFree( func );
+            return( NULL );
+        }
+        func->parm[ i ].sym_handle = parm_handle;
+        func->parm[ i ].const_type = ConstParmType( parm->sym_type );
+        if( func->parm[ i ].const_type == TYPE_VOID ) {
+            func->parm[ i ].state = PARM_VARYING;
+        } else {
+            func->parm[ i ].state = PARM_UNSEEN;
+        }
+        ++i;
+    }
+    func->parm_count = i;
+    return( func );
+}
+
+local const_func *FindConstFunc( const_func *list, SYM_HANDLE sym_handle )
+{
+    for( ; list != NULL; list = list->next ) {
+        if( list->sym_handle == sym_handle ) break;
+    }
+    return( list );
+}
+
+local struct const_parm *FindConstParm( const_func *func, SYM_HANDLE sym_handle )
+{
+    int         i;
+
+    if( func != NULL ) {
+        for( i = 0; i < func->parm_count; ++i ) {
+            if( func->parm[ i ].sym_handle == sym_handle ) {
+                return( &func->parm[ i ] );
+            }
+        }
+    }
+    return( NULL );
+}
+
+local void NoConstParms( const_func *func )
+{
+    int         i;
+
+    for( i = 0; i < func->parm_count; ++i ) {
+        func->parm[ i ].state = PARM_VARYING;
+    }
+}
+
+local void ConstCallParms( const_func *func, TREEPTR parms )
+{
+    struct const_parm   *p;
+    TREEPTR             arg;
+    int                 i;
+
+    i = 0;
+    for( ; parms != NULL; parms = parms->left ) {
+        if( i == func->parm_count ) break;
+        p = &func->parm[ i++ ];
+        arg = parms->right;
+        if( p->state == PARM_VARYING ) continue;
+        if( arg->op.opr != OPR_PUSHINT || arg->op.const_type != p->const_type ) {
+            p->state = PARM_VARYING;
+        } else if( p->state == PARM_UNSEEN ) {
+            p->state = PARM_CONST;
+            p->value = arg->op.ulong_value;
+        } else if( p->value != arg->op.ulong_value ) {
+            p->state = PARM_VARYING;
+        }
+    }
+    if( parms != NULL || i != func->parm_count ) {
+        NoConstParms( func );
+    }
+}
+
+local void ConstScanNode( const_func *list, const_func *cur, TREEPTR node )
+{
+    struct const_parm   *p;
+    const_func          *func;
+    SYM_ENTRY           sym;
+
+    switch( node->op.opr ) {
+    case OPR_PUSHADDR:
+        p = FindConstParm( cur, node->op.sym_handle );
+        if( p != NULL ) {
+            p->state = PARM_VARYING;
+        }
+        break;
+    case OPR_PUSHSYM:
+        if( node->op.flags & OPFLAG_VOLATILE ) {
+            p = FindConstParm( cur, node->op.sym_handle );
+            if( p != NULL ) {
+                p->state = PARM_VARYING;
+            }
+        }
+        break;
+    case OPR_CALL:
+        if( node->left == NULL || node->left->op.opr != OPR_FUNCNAME )
+            break;
+        func = FindConstFunc( list, node->left->op.sym_handle );
+        if( func != NULL ) {
+            ConstCallParms( func, node->right );
+        }
+        if( cur != NULL ) {
+            /* inline code may get at the parms without the tree knowing */
+            SymGet( &sym, node->left->op.sym_handle );
+            if( FindInfo( &sym, node->left->op.sym_handle )->code != NULL ) {
+                NoConstParms( cur );
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+local void PropagateConstParms( void )
+{
+    TREEPTR             tree;
+    TREEPTR             node;
+    const_func          *list;
+    const_func          *func;
+    const_func          *cur;
+    struct const_parm   *p;
+
+    list = NULL;
+    for( tree = FirstStmt; tree != NULL; tree = tree->left ) {
+        if( tree->right->op.opr == OPR_FUNCTION ) {
+            func = NewConstFunc( tree->right->op.func.sym_handle );
+            if( func != NULL ) {
+                func->next = list;
+                list = func;
+            }
+        }
+    }
+    if( list == NULL )
+        return;
+    cur = NULL;
+    for( tree = FirstStmt; tree != NULL; tree = tree->left ) {
+        if( tree->right->op.opr == OPR_FUNCTION ) {
+            cur = FindConstFunc( list, tree->right->op.func.sym_handle );
+        }
+        for( node = LinearizeTree( tree->right ); node != NULL; node = node->thread ) {
+            ConstScanNode( list, cur, node );
+        }
+        if( tree->right->op.opr == OPR_FUNCEND ) {
+            cur = NULL;
+        }
+    }
+    for( tree = FirstStmt; tree != NULL; tree = tree->left ) {
+        if( tree->right->op.opr == OPR_FUNCTION ) {
+            cur = FindConstFunc( list, tree->right->op.func.sym_handle );
+        }
+        if( cur != NULL ) {
+            for( node = LinearizeTree( tree->right ); node != NULL; node = node->thread ) {
+                if( node->op.opr != OPR_PUSHSYM ) continue;
+                p = FindConstParm( cur, node->op.sym_handle );
+                if( p == NULL || p->state != PARM_CONST ) continue;
+                node->op.opr = OPR_PUSHINT;
+                node->op.const_type = p->const_type;
+                node->op.ulong_value = p->value;
+            }
+        }
+        if( tree->right->op.opr == OPR_FUNCEND ) {
+            cur = NULL;
+        }
+    }
+    while( list != NULL ) {
+        func = list->next;
+        CMemFree( list );
+        list = func;
+    }
+}
+
 local void GenModuleCode( void )
 {
     TREEPTR     tree;
@@ -1414,6 +1654,9 @@ void DoCompile( void )
                 TryTableBackHandles = NULL;
 #endif
                 PruneFunctions();
+                if( (GenSwitches & NO_OPTIMIZATION) == 0 ) {
+                    PropagateConstParms();
+                }
                 GenModuleCode();
                 FreeStrings();
                 FiniSegLabels();                        /* 15-mar-92 */
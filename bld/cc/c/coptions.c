@@ -597,6 +597,11 @@ static void MacroDefs( void )
     if( TargetSwitches & GEN_FWAIT_386 ) {
         Define_Macro( "__SW_ZFW" );
     }
+#if _CPU == 386
+    if( TargetSwitches & SSE2_CONVERT ) {
+        Define_Macro( "__SW_FPS" );
+    }
+#endif
 #endif
 #if _CPU == _AXP || _CPU == _PPC || _CPU == _MIPS
     if( GenSwitches & OBJ_ENDIAN_BIG ) {
@@ -909,6 +914,9 @@ static void Set_FPI87( void )       { SwData.fpt = SW_FPT_INLINE; }
 static void Set_Emu( void )         { SwData.fpt = SW_FPT_EMU; }
 static void Set_FPC( void )         { SwData.fpt = SW_FPT_CALLS; }
 static void Set_FPD( void )         { TargetSwitches |= P5_DIVIDE_CHECK; }
+#if _CPU == 386
+static void Set_FPS( void )         { TargetSwitches |= SSE2_CONVERT; }
+#endif
 
 static void SetMemoryModel( void )  { SwData.mem = OptValue; }
 #endif
@@ -1140,6 +1148,16 @@ static void Set_FR( void )
     }
 }
 
+static void Set_FSP( void )
+{
+    CMemFree( ProfileFileName );
+    ProfileFileName = GetAFileName();
+    if( *ProfileFileName == '\0' ) {
+        CMemFree( ProfileFileName );
+        ProfileFileName = NULL;
+    }
+}
+
 #if _CPU == 8086 || _CPU == 386
 static void SetCodeClass( void )    { CodeClassName = CopyOfParm(); }
 static void SetDataSegName( void )
@@ -1685,6 +1703,7 @@ static struct option const CFE_Options[] = {
     { "fld",    0,              Set_FLD },
     { "fo=@",   0,              Set_FO },
     { "fr=@",   0,              Set_FR },
+    { "fsp=@",  0,              Set_FSP },
     { "fti",    0,              SetTrackInc },
 #if _CPU == 8086 || _CPU == 386
     { "fp2",    SW_FPU0,        SetFPU },
@@ -1696,6 +1715,9 @@ static struct option const CFE_Options[] = {
     { "fpi",    0,              Set_Emu },
     { "fpc",    0,              Set_FPC },
     { "fpd",    0,              Set_FPD },
+#endif
+#if _CPU == 386
+    { "fps",    0,              Set_FPS },
 #endif
     { "j",      0,              SetCharType },
     { "tp=$",   0,              Set_TP },
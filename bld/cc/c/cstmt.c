@@ -30,6 +30,7 @@
 
 
 #include "cvars.h"
+#include "cgswitch.h"
 #include "i64.h"
 
 typedef struct block_entry {
@@ -69,6 +70,10 @@ static BLOCKPTR     LoopStack;
 static SWITCHPTR    SwitchStack;
 
 extern  int     LoopDecl( SYM_HANDLE *sym_head );
+#if _CPU == 386
+extern  TREEPTR CallNode( TREEPTR func, TREEPTR parms, TYPEPTR func_result );
+extern  TREEPTR ParmNode( TREEPTR parmlist, TREEPTR newparm, int far16_func );
+#endif
 
 void StmtInit( void )
 {
@@ -1200,6 +1205,270 @@ static void FixupC99MainReturn( SYM_HANDLE func_result, struct return_info *info
 }
 
 
+#if _CPU == 386
+
+/* a local that no store through a pointer can reach */
+static bool PrivateLocal( TREEPTR leaf )
+{
+    SYM_ENTRY   sym;
+
+    if( leaf->op.opr != OPR_PUSHSYM || (leaf->op.flags & OPFLAG_VOLATILE) ) {
+        return( FALSE );
+    }
+    SymGet( &sym, leaf->op.sym_handle );
+    if( sym.stg_class != SC_AUTO && sym.stg_class != SC_REGISTER ) {
+        return( FALSE );
+    }
+    if( sym.attrib & FLAG_VOLATILE ) {
+        return( FALSE );
+    }
+    return( (sym.flags & SYM_ADDR_TAKEN) == 0 );
+}
+
+
+static bool IsCounter( TREEPTR leaf )
+{
+    if( !PrivateLocal( leaf ) ) {
+        return( FALSE );
+    }
+    switch( DataTypeOf( TypeOf( leaf ) ) ) {
+    case TYPE_INT:
+    case TYPE_UINT:
+    case TYPE_LONG:
+    case TYPE_ULONG:
+        return( TRUE );
+    default:
+        break;
+    }
+    return( FALSE );
+}
+
+
+/* size of the element a[iv], 0 if it is not a near integer */
+static unsigned long ElemSize( TREEPTR tree, TREEPTR iv )
+{
+    TREEPTR     base;
+    TYPEPTR     typ;
+    SYM_ENTRY   sym;
+
+    if( tree->op.opr != OPR_INDEX ) {
+        return( 0 );
+    }
+    if( tree->op.flags & (OPFLAG_VOLATILE | OPFLAG_FARPTR | OPFLAG_HUGEPTR) ) {
+        return( 0 );
+    }
+    if( tree->right->op.opr != OPR_PUSHSYM
+      || tree->right->op.sym_handle != iv->op.sym_handle ) {
+        return( 0 );
+    }
+    base = tree->left;
+    typ = TypeOf( base );
+    if( base->op.opr == OPR_PUSHADDR && typ->decl_type == TYPE_ARRAY ) {
+        SymGet( &sym, base->op.sym_handle );
+        if( sym.attrib & (FLAG_FAR | FLAG_HUGE | FLAG_FAR16 | FLAG_BASED) ) {
+            return( 0 );
+        }
+    } else if( base->op.opr == OPR_PUSHSYM && typ->decl_type == TYPE_POINTER ) {
+        if( !PrivateLocal( base ) ) {
+            return( 0 );
+        }
+        if( typ->u.p.decl_flags & (FLAG_FAR | FLAG_HUGE | FLAG_FAR16 | FLAG_BASED) ) {
+            return( 0 );
+        }
+    } else {
+        return( 0 );
+    }
+    typ = TypeOf( tree );
+    switch( DataTypeOf( typ ) ) {
+    case TYPE_CHAR:
+    case TYPE_UCHAR:
+    case TYPE_SHORT:
+    case TYPE_USHORT:
+    case TYPE_INT:
+    case TYPE_UINT:
+    case TYPE_LONG:
+    case TYPE_ULONG:
+        return( SizeOfArg( typ ) );
+    default:
+        break;
+    }
+    return( 0 );
+}
+
+
+/* byte that memset must store to give v in every element */
+static TREEPTR FillByte( TREEPTR v, unsigned long size )
+{
+    unsigned long   value;
+    unsigned long   byte;
+    SYM_ENTRY       sym;
+
+    if( v->op.opr == OPR_PUSHINT ) {
+        value = v->op.ulong_value;
+        byte = value & 0xff;
+        while( --size > 0 ) {
+            value >>= 8;
+            if( (value & 0xff) != byte ) {
+                return( NULL );
+            }
+        }
+        return( IntLeaf( byte ) );
+    }
+    if( size == 1 && PrivateLocal( v ) && SizeOfArg( TypeOf( v ) ) == 1 ) {
+        SymGet( &sym, v->op.sym_handle );
+        return( RValue( VarLeaf( &sym, v->op.sym_handle ) ) );
+    }
+    return( NULL );
+}
+
+
+static TREEPTR LeafCopy( TREEPTR leaf )
+{
+    TREEPTR     tree;
+    SYM_ENTRY   sym;
+
+    if( leaf->op.opr == OPR_PUSHINT ) {
+        tree = LeafNode( OPR_PUSHINT );
+        tree->op.const_type = leaf->op.const_type;
+        tree->op.long_value = leaf->op.long_value;
+        tree->expr_type = leaf->expr_type;
+    } else {
+        SymGet( &sym, leaf->op.sym_handle );
+        tree = VarLeaf( &sym, leaf->op.sym_handle );
+    }
+    return( tree );
+}
+
+
+static TREEPTR ElemAddr( TREEPTR tree )
+{
+    TYPEPTR     typ;
+
+    typ = tree->expr_type;
+    tree->op.flags &= ~OPFLAG_RVALUE;
+    tree = ExprNode( NULL, OPR_ADDROF, tree );
+    tree->expr_type = PtrNode( typ, FLAG_NONE, SEG_DATA );
+    return( tree );
+}
+
+
+static TREEPTR InlineCall( SYM_HANDLE func, TREEPTR dst, TREEPTR src, TREEPTR len )
+{
+    TREEPTR     tree;
+    TREEPTR     parms;
+    SYM_ENTRY   sym;
+
+    SymGet( &sym, func );
+    tree = VarLeaf( &sym, func );
+    tree->op.opr = OPR_FUNCNAME;
+    parms = ParmNode( NULL, len, 0 );
+    parms = ParmNode( parms, src, 0 );
+    parms = ParmNode( parms, dst, 0 );
+    return( CallNode( tree, parms, sym.sym_type->object ) );
+}
+
+
+/*
+ * Match the statements of
+ *      top:    if( !(i < n) ) goto out;
+ *              a[i] = v;               or a[i] = b[i];
+ *              ++i;
+ *              goto top;
+ * as built for a 'for' or 'while' loop and turn the body into one
+ * memset or memcpy of the remaining elements, which the inline
+ * pragma code does with rep stos or rep movs.  The increment becomes
+ * i = n so the test still ends the loop with i as it would have been.
+ */
+static void LoopIdiom( TREEPTR top )
+{
+    TREEPTR         test;
+    TREEPTR         body;
+    TREEPTR         step;
+    TREEPTR         back;
+    TREEPTR         inc;
+    TREEPTR         cmp;
+    TREEPTR         iv;
+    TREEPTR         bound;
+    TREEPTR         asgn;
+    TREEPTR         src;
+    TREEPTR         len;
+    SYM_HANDLE      func;
+    DATA_TYPE       iv_type;
+    unsigned long   size;
+
+    test = top->left;
+    if( test == NULL || test->left == NULL ) return;
+    body = test->left;
+    step = body->left;
+    if( step == NULL || step->left == NULL ) return;
+    back = step->left;
+    if( test->right->op.opr != OPR_JUMPFALSE ) return;
+    if( back->right->op.opr != OPR_JUMP ) return;
+    if( back->right->op.label_index != top->right->op.label_index ) return;
+    cmp = test->right->right;
+    if( cmp->op.opr != OPR_CMP || cmp->op.cc != CC_LT ) return;
+    iv = cmp->left;
+    bound = cmp->right;
+    if( !IsCounter( iv ) ) return;
+    iv_type = DataTypeOf( TypeOf( iv ) );
+    if( DataTypeOf( cmp->op.compare_type ) != iv_type ) return;
+    if( bound->op.opr != OPR_PUSHINT ) {
+        if( !PrivateLocal( bound ) ) return;
+        if( bound->op.sym_handle == iv->op.sym_handle ) return;
+        if( DataTypeOf( TypeOf( bound ) ) != iv_type ) return;
+    }
+    inc = step->right;
+    if( inc->op.opr != OPR_POSTINC && inc->op.opr != OPR_PLUS_EQUAL ) return;
+    if( inc->left->op.opr != OPR_PUSHADDR ) return;
+    if( inc->left->op.sym_handle != iv->op.sym_handle ) return;
+    if( inc->right->op.opr != OPR_PUSHINT || inc->right->op.long_value != 1 ) return;
+    asgn = body->right;
+    if( asgn->op.opr != OPR_EQUALS || (asgn->op.flags & OPFLAG_VOLATILE) ) return;
+    size = ElemSize( asgn->left, iv );
+    if( size == 0 ) return;
+    if( asgn->right->op.opr == OPR_INDEX ) {
+        /* only between distinct arrays, pointers might overlap */
+        src = asgn->right;
+        if( ElemSize( src, iv ) != size ) return;
+        if( DataTypeOf( TypeOf( src ) ) != DataTypeOf( TypeOf( asgn->left ) ) ) return;
+        if( asgn->left->left->op.opr != OPR_PUSHADDR ) return;
+        if( src->left->op.opr != OPR_PUSHADDR ) return;
+        if( src->left->op.sym_handle == asgn->left->left->op.sym_handle ) return;
+        asgn->right = NULL;
+        src = ElemAddr( src );
+        func = SymMEMCPY;
+    } else {
+        src = FillByte( asgn->right, size );
+        if( src == NULL ) return;
+        func = SymMEMSET;
+    }
+    len = AddOp( LeafCopy( bound ), T_MINUS, LeafCopy( iv ) );
+    len = CnvOp( len, GetType( TYPE_UINT ), 0 );
+    if( size != 1 ) {
+        len = BinOp( len, T_TIMES, UIntLeaf( size ) );
+    }
+    body->right = InlineCall( func, ElemAddr( asgn->left ), src, len );
+    asgn->left = NULL;
+    FreeExprTree( asgn );
+    FreeExprTree( inc );
+    step->right = AsgnOp( LeafCopy( iv ), T_EQUAL, LeafCopy( bound ) );
+}
+
+
+static void LoopIdioms( TREEPTR stmt )
+{
+    if( GenSwitches & NO_OPTIMIZATION ) return;
+    if( (GenSwitches & LOOP_OPTIMIZATION) == 0 ) return;
+    if( TargetSwitches & (BIG_DATA | FLOATING_SS) ) return;
+    for( ; stmt != NULL; stmt = stmt->left ) {
+        if( stmt->right->op.opr == OPR_LABEL ) {
+            LoopIdiom( stmt );
+        }
+    }
+}
+#endif
+
+
 void Statement( void )
 {
     LABEL_INDEX         end_of_func_label;
@@ -1210,6 +1479,9 @@ void Statement( void )
     bool                declaration_allowed;
     struct return_info  return_info;
     SYM_ENTRY           sym;
+#if _CPU == 386
+    TREEPTR             first_stmt;
+#endif
 
 #ifndef NDEBUG
     if( DebugFlag >= 1 ) {
@@ -1240,6 +1512,9 @@ void Statement( void )
     ++SymLevel;
     tree = LeafNode( OPR_LABELCOUNT );
     AddStmt( tree );
+#if _CPU == 386
+    first_stmt = LastStmt;
+#endif
     if( GrabLabels() == 0 ) {                           /* 29-nov-94 */
         GetLocalVarDecls();
     }
@@ -1437,6 +1712,9 @@ void Statement( void )
     if( end_of_func_label != 0 ) {
         DropLabel( end_of_func_label );
     }
+#if _CPU == 386
+    LoopIdioms( first_stmt );
+#endif
     DeadCode = 0;
     tree->op.label_count = LabelIndex;
     tree = LeafNode( OPR_FUNCEND );
@@ -222,6 +222,9 @@ void SpcSymInit( void )
     SymSTOD  = MakeFunction( "_inline_.stosd",  GetType( TYPE_VOID ) );
     SymSTOSB = MakeFunction( "__STOSB", GetType( TYPE_VOID ) );
     SymSTOSD = MakeFunction( "__STOSD", GetType( TYPE_VOID ) );
+    /* fill and copy loops become calls to these, see LoopIdioms() */
+    SymMEMSET = MakeFunction( "_inline_memset", TypeNode( TYPE_FUNCTION, ptr2char ) );
+    SymMEMCPY = MakeFunction( "_inline_memcpy", TypeNode( TYPE_FUNCTION, ptr2char ) );
 #endif
 #ifdef __SEH__
     SymTryInit = MakeFunction( "__TryInit", typ );      /* 05-dec-92 */
@@ -155,6 +155,8 @@ global  SYM_HANDLE GlobalSym;   /* global symbol table list head */
 global  SYM_HANDLE SymSTOD;     /* builtin symbol for 'rep stosd' */
 global  SYM_HANDLE SymSTOSB;    /* builtin symbol for '__STOSB' */
 global  SYM_HANDLE SymSTOSD;    /* builtin symbol for '__STOSD' */
+global  SYM_HANDLE SymMEMSET;   /* builtin symbol for inline 'memset' */
+global  SYM_HANDLE SymMEMCPY;   /* builtin symbol for inline 'memcpy' */
 #endif
 #ifdef __SEH__
 global  SYM_HANDLE SymTryInit;  /* builtin symbol for '__TryInit' */
@@ -408,6 +410,7 @@ global  unsigned        UnrollCount;    /* #pragma unroll(#); */
 global  macro_flags     InitialMacroFlag;
 global  unsigned char   Stack87;
 global  char            *ErrorFileName;
+global  char            *ProfileFileName; /* -fsp wprof profile */
 
 global struct  undef_names {
     struct undef_names  *next;
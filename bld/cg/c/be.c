@@ -441,6 +441,12 @@ extern  bool    BEMoreMem() {
     return(FALSE);
 }
 
+extern  unsigned_32 BEMemInUse() {
+//================================
+
+    return( 0 );
+}
+
 extern  unsigned_32 BEUnrollCount( unsigned_32 c ) {
 /**************************************************/
     return( c );
@@ -64,6 +64,7 @@ extern void BEStop() {}
 extern void BEAbort() {}
 extern void BEFini() {}
 extern bool BEMoreMem() {return(0);}
+extern unsigned_32 BEMemInUse() {return(0);}
 extern segment_id BESetSeg(segment_id _1) {return(0);}
 extern void BEDefSeg(segment_id _1,seg_attr _2,char * _3,uint _4) {}
 extern void BEFlushSeg(segment_id _1 ) {}
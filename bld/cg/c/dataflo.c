@@ -30,7 +30,6 @@
 ****************************************************************************/
 
 
-#define GB_DEFINE_GBITNEXT
 #include "standard.h"
 #include "cgdefs.h"
 #include "coderep.h"
@@ -57,8 +56,6 @@ static  void            PropagateConflicts( void );
 static  void            LiveAnalysis( block *tail, global_bit_set memory_bits );
 extern  void            SetInOut( block *blk );
 
-static  bool            MoreUseInOtherTemps;
-
 
 static  void    AddTempSave( name *op, block *blk )
 /*************************************************/
@@ -104,9 +101,8 @@ static  bool    AllocBefore( void *n1, void *n2 )
 static  void    RoughSortTemps( void )
 /*************************************
 
-    Do a real rough sort on the templist by savings in case
-    we run out of global bits. This will help the register
-    allocator do the right thing
+    Do a real rough sort on the templist by savings. This will
+    help the register allocator do the right thing
 */
 {
     name                *actual_name;
@@ -142,8 +138,8 @@ static  void    RoughSortTemps( void )
 
 
 static  global_bit_set AssignGlobalBits( name_class_def list,
-                             global_bit_set *bit, bool first_time )
-/*****************************************************************/
+                                        global_bit_set *bit )
+/************************************************************/
 {
     conflict_node       *conf;
     global_bit_set      all_used;
@@ -151,11 +147,6 @@ static  global_bit_set AssignGlobalBits( name_class_def list,
     name                *opnd;
 
     opnd = Names[ list ];
-    if( list == N_TEMP ) {
-        _GBitInit( all_used, EMPTY );
-        if( !MoreUseInOtherTemps ) return( all_used );
-        MoreUseInOtherTemps = FALSE;
-    }
     _GBitInit( all_used, EMPTY );
     while( opnd != NULL ) {
         if( ( opnd->v.usage & ( USE_MEMORY | USE_ADDRESS ) ) ) {
@@ -165,23 +156,15 @@ static  global_bit_set AssignGlobalBits( name_class_def list,
             if( list == N_TEMP ) {
                 actual_name = DeAlias( actual_name );
             }
-            if( _GBitEmpty( *bit ) && ( list == N_MEMORY ) ) {
-                actual_name->v.usage |= NEEDS_MEMORY | USE_MEMORY;
-            } else {
-                conf = actual_name->v.conflict;
-                if( conf == NULL && first_time ) {
-                    conf = AddConflictNode( actual_name );
-                }
-                if( conf != NULL && !( conf->state & CONFLICT_ON_HOLD )
-                 && _GBitEmpty( conf->id.out_of_block ) ) {
-                    _GBitAssign( conf->id.out_of_block, *bit );
-                    _GBitTurnOn( all_used, *bit );
-                    _GBitNext( bit );
-                    if( _GBitEmpty( conf->id.out_of_block ) ) {
-                        conf->state |= CONFLICT_ON_HOLD;
-                        MoreUseInOtherTemps = TRUE;
-                    }
-                }
+            conf = actual_name->v.conflict;
+            if( conf == NULL ) {
+                conf = AddConflictNode( actual_name );
+            }
+            if( !( conf->state & CONFLICT_ON_HOLD )
+             && _GBitEmpty( conf->id.out_of_block ) ) {
+                _GBitAssign( conf->id.out_of_block, *bit );
+                _GBitTurnOn( all_used, *bit );
+                _GBitNext( bit );
             }
         }
         opnd = opnd->n.next_name;
@@ -218,13 +201,12 @@ extern  void    MakeConflicts( void )
     global_bit_set     bit;
 
     CheckGlobals();
-    MoreUseInOtherTemps = TRUE;
     _GBitFirst( bit );
     if( !BlockByBlock ) {
         RoughSortTemps();
     }
-    AssignGlobalBits( N_TEMP, &bit, TRUE );
-    MemoryBits = AssignGlobalBits( N_MEMORY, &bit, TRUE );
+    AssignGlobalBits( N_TEMP, &bit );
+    MemoryBits = AssignGlobalBits( N_MEMORY, &bit );
     PropagateConflicts();
 }
 
@@ -232,17 +214,12 @@ extern  void    MakeConflicts( void )
 extern  bool    MoreConflicts( void )
 /***********************************/
 {
-    global_bit_set     bit;
+    /*   MakeConflicts gave a global bit to every name living across*/
+    /*   blocks, since the sets never run out of bits, so there is*/
+    /*   nothing left over for another round*/
 
-    _GBitFirst( bit );
     _GBitInit( MemoryBits, EMPTY );
-    bit = AssignGlobalBits( N_TEMP, &bit, FALSE );
-    if( !_GBitEmpty( bit ) ) {
-        PropagateConflicts();
-        return( TRUE );
-    } else {
-        return( FALSE );
-    }
+    return( FALSE );
 }
 
 
@@ -252,9 +229,8 @@ static  void    PropagateConflicts( void )
 {
     block       *blk;
 
-    /*   Assign global bits to temporaries first in case we run out of*/
-    /*   bits.*/
-    /*   (When we run out of bits, everything } else { is forced to memory)*/
+    /*   Global bit sets grow as needed (see gbit.h), so every name*/
+    /*   that lives across blocks gets a bit of its own*/
 
     FindReferences();
     if( BlockByBlock == FALSE ) {
@@ -293,10 +269,16 @@ static  void    LiveAnalysis( block *tail, global_bit_set memory_bits )
     block               *target;
     data_flow_def       *data;
     global_bit_set      new;
+    gbit_scratch        flow;
     int                 i;
     bool                change;
 
 
+    /*   Sets are built in flow, so only the ones that change get*/
+    /*   allocated (see gbit.h)*/
+
+    flow.size = 0;
+
     /*   Want tail of block list, to do inside-out traversal of*/
     /*   depth first spanning tree*/
 
@@ -313,9 +295,9 @@ static  void    LiveAnalysis( block *tail, global_bit_set memory_bits )
             /*   defined within the procedure*/
 
             if( blk->class & ( RETURN | LABEL_RETURN ) ) {
-                new = memory_bits;
+                GBitScratchLoad( &flow, memory_bits );
             } else {
-                _GBitInit( new, EMPTY );
+                GBitScratchLoad( &flow, NULL );
             }
             if( ( blk->class & BIG_JUMP ) == EMPTY ) {
                 i = blk->targets;
@@ -324,19 +306,21 @@ static  void    LiveAnalysis( block *tail, global_bit_set memory_bits )
 
                     /*   new OUT = union of successors' IN*/
 
-                    _GBitTurnOn( new, target->dataflow->in );
+                    GBitScratchOn( &flow, target->dataflow->in );
                 }
             }
-            if( !_GBitSame( data->out, new ) ) {
-                data->out = new;
+            new = GBitScratchSet( &flow, data->out );
+            if( new != data->out ) {
+                _GBitAssign( data->out, new );
                 change = TRUE;
             }
 
             /*   new IN == ( new OUT - DEF ) union USE*/
 
-            _GBitTurnOff( new, data->def );
-            _GBitTurnOn( new, data->use );
-            if( !_GBitSame( data->in, new ) ) {
+            GBitScratchOff( &flow, data->def );
+            GBitScratchOn( &flow, data->use );
+            new = GBitScratchSet( &flow, data->in );
+            if( new != data->in ) {
                 _GBitAssign( data->in, new );
                 change = TRUE;
             }
@@ -345,4 +329,5 @@ static  void    LiveAnalysis( block *tail, global_bit_set memory_bits )
         }
         if( change == FALSE ) break;
     }
+    GBitScratchFree( &flow );
 }
@@ -0,0 +1,524 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Global bit set operations.
+*
+****************************************************************************/
+
+
+#include <stddef.h>
+#include <string.h>
+#include "standard.h"
+#include "coderep.h"
+#include "procdef.h"
+#include "cgmem.h"
+
+/*
+ * See gbit.h for the representation. Each operation makes one pass over
+ * its operands to size the result and to spot the (common) cases where
+ * the result is one of the operands, and a second pass to fill in a new
+ * set only when it is needed. Sets are carved out of chunks hung off the
+ * current procedure, since nothing keeps track of which sets are still
+ * in use until the whole procedure is thrown away. So that does not pile
+ * up, the last result of Combine() is remembered (runs of instructions
+ * share one live set, and get the same bits taken out of it), and the
+ * live analysis builds its sets in a gbit_scratch.
+ */
+
+#define CHUNK_SIZE      4096
+#define _SetSize( n )   ( offsetof( gbit_set, word ) + (n) * sizeof( gbit_word ) )
+
+typedef struct gbit_chunk {
+        struct gbit_chunk       *next;
+        unsigned                left;           /* bytes free at the end */
+} gbit_chunk;
+
+typedef enum {
+        GB_UNION,
+        GB_DIFF,
+        GB_INTERSECT
+} gbit_op;
+
+extern  proc_def        *CurrProc;
+extern  global_bit_set  MemoryBits;
+
+static  struct {
+        gbit_op                 op;
+        global_bit_set          a;
+        global_bit_set          b;
+        global_bit_set          result;
+} Last;
+
+
+static  global_bit_set  NewSet( unsigned count )
+/**********************************************/
+{
+    gbit_chunk          *chunk;
+    gbit_chunk          *new;
+    gbit_set            *set;
+    unsigned            size;
+
+    size = _SetSize( count );
+    chunk = CurrProc->gbit_chunks;
+    if( size > CHUNK_SIZE / 4 ) {
+        /* big sets get a chunk of their own, behind the current one */
+        new = CGAlloc( sizeof( gbit_chunk ) + size );
+        new->left = 0;
+        if( chunk == NULL ) {
+            new->next = NULL;
+            CurrProc->gbit_chunks = new;
+        } else {
+            new->next = chunk->next;
+            chunk->next = new;
+        }
+        set = (gbit_set *)( new + 1 );
+    } else {
+        if( chunk == NULL || chunk->left < size ) {
+            new = CGAlloc( sizeof( gbit_chunk ) + CHUNK_SIZE );
+            new->left = CHUNK_SIZE;
+            new->next = chunk;
+            CurrProc->gbit_chunks = new;
+            chunk = new;
+        }
+        set = (gbit_set *)( (char *)( chunk + 1 ) + CHUNK_SIZE - chunk->left );
+        chunk->left -= size;
+    }
+    set->count = count;
+    return( set );
+}
+
+
+extern  void    FreeGBits( proc_def *proc )
+/*****************************************/
+{
+    gbit_chunk          *chunk;
+    gbit_chunk          *next;
+
+    for( chunk = proc->gbit_chunks; chunk != NULL; chunk = next ) {
+        next = chunk->next;
+        CGFree( chunk );
+    }
+    proc->gbit_chunks = NULL;
+    _GBitInit( MemoryBits, EMPTY );
+    Last.a = NULL;
+}
+
+
+static  gbit_word       *FindWord( global_bit_set set, unsigned index )
+/*********************************************************************/
+{
+    unsigned            lo;
+    unsigned            hi;
+    unsigned            mid;
+
+    lo = 0;
+    hi = set->count;
+    while( lo < hi ) {
+        mid = ( lo + hi ) / 2;
+        if( set->word[ mid ].index == index ) return( &set->word[ mid ] );
+        if( set->word[ mid ].index < index ) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return( NULL );
+}
+
+
+static  unsigned        Merge( gbit_op op, global_bit_set a, global_bit_set b,
+                               gbit_word *out, bool *same_a, bool *same_b )
+/*************************************************************************/
+/* Combine a and b, neither of them NULL, a word at a time. Returns the */
+/* number of words in the result, and stores them at out unless it is NULL */
+{
+    gbit_word           *wa;
+    gbit_word           *wb;
+    gbit_word           *enda;
+    gbit_word           *endb;
+    a_bit_set           abits;
+    a_bit_set           bbits;
+    a_bit_set           bits;
+    unsigned            index;
+    unsigned            count;
+
+    wa = a->word;
+    enda = wa + a->count;
+    wb = b->word;
+    endb = wb + b->count;
+    count = 0;
+    *same_a = TRUE;
+    *same_b = TRUE;
+    while( wa < enda || wb < endb ) {
+        if( wb == endb || ( wa < enda && wa->index < wb->index ) ) {
+            index = wa->index;
+            abits = wa->bits;
+            bbits = 0;
+            ++wa;
+        } else if( wa == enda || wb->index < wa->index ) {
+            index = wb->index;
+            abits = 0;
+            bbits = wb->bits;
+            ++wb;
+        } else {
+            index = wa->index;
+            abits = wa->bits;
+            bbits = wb->bits;
+            ++wa;
+            ++wb;
+        }
+        switch( op ) {
+        case GB_UNION:
+            bits = abits | bbits;
+            break;
+        case GB_DIFF:
+            bits = abits & ~bbits;
+            break;
+        default:
+            bits = abits & bbits;
+            break;
+        }
+        if( bits != abits ) *same_a = FALSE;
+        if( bits != bbits ) *same_b = FALSE;
+        if( bits != 0 ) {
+            if( out != NULL ) {
+                out[ count ].index = index;
+                out[ count ].bits = bits;
+            }
+            ++count;
+        }
+    }
+    return( count );
+}
+
+
+static  global_bit_set  Combine( gbit_op op, global_bit_set a, global_bit_set b )
+/*******************************************************************************/
+/* neither a nor b may be NULL */
+{
+    global_bit_set      set;
+    unsigned            count;
+    bool                same_a;
+    bool                same_b;
+
+    if( Last.a == a && Last.b == b && Last.op == op ) return( Last.result );
+    count = Merge( op, a, b, NULL, &same_a, &same_b );
+    if( same_a ) return( a );
+    if( same_b ) return( b );
+    if( count == 0 ) return( NULL );
+    set = NewSet( count );
+    Merge( op, a, b, set->word, &same_a, &same_b );
+    Last.op = op;
+    Last.a = a;
+    Last.b = b;
+    Last.result = set;
+    return( set );
+}
+
+
+extern  global_bit_set  GBitUnion( global_bit_set a, global_bit_set b )
+/*********************************************************************/
+{
+    gbit_word           *w;
+
+    if( a == b || b == NULL ) return( a );
+    if( a == NULL ) return( b );
+    if( b->count == 1 ) {
+        w = FindWord( a, b->word[ 0 ].index );
+        if( w != NULL && ( b->word[ 0 ].bits & ~w->bits ) == 0 ) return( a );
+    }
+    return( Combine( GB_UNION, a, b ) );
+}
+
+
+extern  global_bit_set  GBitDiff( global_bit_set a, global_bit_set b )
+/********************************************************************/
+{
+    gbit_word           *w;
+
+    if( a == b ) return( NULL );
+    if( a == NULL || b == NULL ) return( a );
+    if( b->count == 1 ) {
+        w = FindWord( a, b->word[ 0 ].index );
+        if( w == NULL || ( b->word[ 0 ].bits & w->bits ) == 0 ) return( a );
+    }
+    return( Combine( GB_DIFF, a, b ) );
+}
+
+
+extern  global_bit_set  GBitIntersect( global_bit_set a, global_bit_set b )
+/*************************************************************************/
+{
+    if( a == b ) return( a );
+    if( a == NULL || b == NULL ) return( NULL );
+    return( Combine( GB_INTERSECT, a, b ) );
+}
+
+
+extern  bool    GBitOverlap( global_bit_set a, global_bit_set b )
+/***************************************************************/
+{
+    gbit_word           *wa;
+    gbit_word           *wb;
+    gbit_word           *enda;
+    gbit_word           *endb;
+
+    if( a == NULL || b == NULL ) return( FALSE );
+    if( a == b ) return( TRUE );
+    /* mostly one of them is the single bit of some conflict */
+    if( a->count == 1 ) {
+        wb = FindWord( b, a->word[ 0 ].index );
+        return( wb != NULL && ( wb->bits & a->word[ 0 ].bits ) != 0 );
+    }
+    if( b->count == 1 ) {
+        wa = FindWord( a, b->word[ 0 ].index );
+        return( wa != NULL && ( wa->bits & b->word[ 0 ].bits ) != 0 );
+    }
+    wa = a->word;
+    enda = wa + a->count;
+    wb = b->word;
+    endb = wb + b->count;
+    while( wa < enda && wb < endb ) {
+        if( wa->index < wb->index ) {
+            ++wa;
+        } else if( wb->index < wa->index ) {
+            ++wb;
+        } else {
+            if( wa->bits & wb->bits ) return( TRUE );
+            ++wa;
+            ++wb;
+        }
+    }
+    return( FALSE );
+}
+
+
+extern  bool    GBitSame( global_bit_set a, global_bit_set b )
+/************************************************************/
+{
+    if( a == b ) return( TRUE );
+    if( a == NULL || b == NULL ) return( FALSE );
+    if( a->count != b->count ) return( FALSE );
+    return( memcmp( a->word, b->word, a->count * sizeof( gbit_word ) ) == 0 );
+}
+
+
+extern  global_bit_set  GBitSingle( unsigned bit )
+/************************************************/
+{
+    global_bit_set      set;
+
+    set = NewSet( 1 );
+    set->word[ 0 ].index = bit / 32;
+    set->word[ 0 ].bits = (a_bit_set)1 << ( bit % 32 );
+    return( set );
+}
+
+
+extern  void    GBitNext( global_bit_set *set )
+/*********************************************/
+/* *set holds a single bit; replace it by a set holding the next one */
+{
+    a_bit_set           bits;
+    unsigned            bit;
+
+    bits = (*set)->word[ 0 ].bits;
+    bit = (*set)->word[ 0 ].index * 32;
+    while( ( bits & 1 ) == 0 ) {
+        bits >>= 1;
+        ++bit;
+    }
+    *set = GBitSingle( bit + 1 );
+}
+
+
+extern  void    GBitIter( void (*routine)( unsigned_32 ), global_bit_set set )
+/****************************************************************************/
+/* call routine with each word up to the last non-zero one */
+{
+    unsigned            index;
+    unsigned            i;
+
+    if( set == NULL ) {
+        routine( 0 );
+        return;
+    }
+    index = 0;
+    for( i = 0; i < set->count; ++i ) {
+        while( index < set->word[ i ].index ) {
+            routine( 0 );
+            ++index;
+        }
+        routine( set->word[ i ].bits );
+        ++index;
+    }
+}
+
+
+extern  void    GBitScratchLoad( gbit_scratch *s, global_bit_set set )
+/********************************************************************/
+{
+    if( s->size != 0 ) {
+        memset( s->bits, 0, s->size * sizeof( a_bit_set ) );
+    }
+    s->set = set;
+    s->changed = FALSE;
+    GBitScratchOn( s, set );
+    s->changed = FALSE;
+}
+
+
+static  void    ScratchGrow( gbit_scratch *s, unsigned index )
+/************************************************************/
+{
+    a_bit_set           *bits;
+    unsigned            size;
+
+    size = s->size * 2;
+    if( size <= index ) {
+        size = index + 4;
+    }
+    bits = CGAlloc( size * sizeof( a_bit_set ) );
+    memset( bits, 0, size * sizeof( a_bit_set ) );
+    if( s->size != 0 ) {
+        memcpy( bits, s->bits, s->size * sizeof( a_bit_set ) );
+        CGFree( s->bits );
+    }
+    s->bits = bits;
+    s->size = size;
+}
+
+
+extern  void    GBitScratchOn( gbit_scratch *s, global_bit_set set )
+/******************************************************************/
+{
+    gbit_word           *w;
+    gbit_word           *end;
+
+    if( set == NULL ) return;
+    w = set->word;
+    end = w + set->count;
+    if( end[ -1 ].index >= s->size ) {
+        ScratchGrow( s, end[ -1 ].index );
+    }
+    for( ; w < end; ++w ) {
+        if( w->bits & ~s->bits[ w->index ] ) {
+            s->bits[ w->index ] |= w->bits;
+            s->changed = TRUE;
+        }
+    }
+}
+
+
+extern  void    GBitScratchOff( gbit_scratch *s, global_bit_set set )
+/*******************************************************************/
+{
+    gbit_word           *w;
+    gbit_word           *end;
+
+    if( set == NULL ) return;
+    w = set->word;
+    end = w + set->count;
+    for( ; w < end && w->index < s->size; ++w ) {
+        if( w->bits & s->bits[ w->index ] ) {
+            s->bits[ w->index ] &= ~w->bits;
+            s->changed = TRUE;
+        }
+    }
+}
+
+
+static  bool    ScratchSame( gbit_scratch *s, global_bit_set set )
+/****************************************************************/
+{
+    unsigned            i;
+    unsigned            j;
+
+    j = 0;
+    for( i = 0; i < s->size; ++i ) {
+        if( set != NULL && j < set->count && set->word[ j ].index == i ) {
+            if( s->bits[ i ] != set->word[ j ].bits ) return( FALSE );
+            ++j;
+        } else if( s->bits[ i ] != 0 ) {
+            return( FALSE );
+        }
+    }
+    return( set == NULL || j == set->count );
+}
+
+
+extern  global_bit_set  GBitScratchSet( gbit_scratch *s, global_bit_set old )
+/***************************************************************************/
+/* the bits in s as a set, which is old if that has the same bits */
+{
+    global_bit_set      set;
+    unsigned            count;
+    unsigned            i;
+
+    if( !s->changed ) {
+        if( s->set != old && GBitSame( s->set, old ) ) {
+            s->set = old;
+        }
+        return( s->set );
+    }
+    s->changed = FALSE;
+    if( ScratchSame( s, old ) ) {
+        s->set = old;
+        return( old );
+    }
+    count = 0;
+    for( i = 0; i < s->size; ++i ) {
+        if( s->bits[ i ] != 0 ) ++count;
+    }
+    if( count == 0 ) {
+        s->set = NULL;
+        return( NULL );
+    }
+    set = NewSet( count );
+    count = 0;
+    for( i = 0; i < s->size; ++i ) {
+        if( s->bits[ i ] != 0 ) {
+            set->word[ count ].index = i;
+            set->word[ count ].bits = s->bits[ i ];
+            ++count;
+        }
+    }
+    s->set = set;
+    return( set );
+}
+
+
+extern  void    GBitScratchFree( gbit_scratch *s )
+/************************************************/
+{
+    if( s->size != 0 ) {
+        CGFree( s->bits );
+    }
+    s->bits = NULL;
+    s->size = 0;
+    s->set = NULL;
+    s->changed = FALSE;
+}
@@ -170,6 +170,14 @@ extern source_line_number       SrcLine;
 static  bool                    abortCG;
 
 
+static  void    CGPhase( cg_phase phase )
+/***************************************/
+/* tell the front end which phase we are in (for its compile-time report) */
+{
+    FEMessage( MSG_PHASE, (pointer)(pointer_int)phase );
+}
+
+
 extern  void    InitCG( void )
 /****************************/
 {
@@ -212,7 +220,9 @@ extern  void    FiniCG( void )
     if( abortCG ) {
         AbortObj();
     }
+    CGPhase( PHASE_OBJECT );
     ObjFini();
+    CGPhase( PHASE_FRONT_END );
     TellFreeAllLabels();
     BlowAwayFreeLists();
     ScoreFini();
@@ -244,6 +254,7 @@ static  void            PreOptimize( void )
         BlockTrim();
         AddANop();
         if( _IsModel( LOOP_OPTIMIZATION ) ) {
+            CGPhase( PHASE_LOOP_OPT );
             change = FALSE;
             if( TransLoops( FALSE ) ) {
                 change = TRUE;
@@ -274,6 +285,7 @@ static  void            PreOptimize( void )
             if( change ) {
                 BlockTrim();
             }
+            CGPhase( PHASE_OPTIMIZE );
         }
         MulToShiftAdd();
         KillMovAddrConsts();
@@ -352,7 +364,9 @@ static  void            PostOptimize( void )
         // Run scheduler last, when all instructions are stable
         if( _IsModel( INS_SCHEDULING ) ) {
             HaveLiveInfo = FALSE;
+            CGPhase( PHASE_SCHEDULE );
             Schedule(); /* NOTE: Schedule messes up live information */
+            CGPhase( PHASE_OPTIMIZE );
             LiveInfoUpdate();
             HaveLiveInfo = TRUE;
         }
@@ -722,13 +736,12 @@ extern  void    ProcMessage( msg_class msg )
 }
 
 
-extern  void    Generate( bool routine_done )
-/*******************************************/
+static  void    GenerateRoutine( bool routine_done )
+/**************************************************/
 /* The big one - here's where most of code generation happens.
  * Follow this routine to see the transformation of code unfold.
  */
 {
-    if( BGInInline() ) return;
     HaveLiveInfo = FALSE;
     HaveDominatorInfo = FALSE;
     #if ( _TARGET & ( _TARG_370 | _TARG_RISC ) ) == 0
@@ -739,6 +752,7 @@ extern  void    Generate( bool routine_done )
                 BlockByBlock = TRUE;
             }
             LNBlip( SrcLine );
+            CGPhase( PHASE_ENCODE );
             FlushBlocks( FALSE );
             FreeExtraSyms( LastTemp );
             if( _MemLow ) {
@@ -810,12 +824,14 @@ extern  void    Generate( bool routine_done )
     }
     FixIndex();
     FixSegments();
+    CGPhase( PHASE_REG_ALLOC );
     FPRegAlloc();
     if( RegAlloc( FALSE ) == FALSE ) {
         Panic( TRUE );
         HaveLiveInfo = FALSE;
         return;
     }
+    CGPhase( PHASE_OPTIMIZE );
     FPParms();
     FixMemBases();
     PostOptimize();
@@ -827,6 +843,7 @@ extern  void    Generate( bool routine_done )
     if( CalcDominatorInfo() ) {
         HaveDominatorInfo = TRUE;
     }
+    CGPhase( PHASE_ENCODE );
     GenProlog();
     UnFixEdges();
     OptSegs();
@@ -844,3 +861,13 @@ extern  void    Generate( bool routine_done )
     FlushQueue();
 #endif
 }
+
+
+extern  void    Generate( bool routine_done )
+/*******************************************/
+{
+    if( BGInInline() ) return;
+    CGPhase( PHASE_OPTIMIZE );
+    GenerateRoutine( routine_done );
+    CGPhase( PHASE_FRONT_END );
+}
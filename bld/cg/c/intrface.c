@@ -63,6 +63,9 @@ extern  seg_id          AskOP(void);
 extern  void            InitBlip(void);
 extern  void            FiniBlip(void);
 extern  void            InitWeights(uint);
+extern  void            ProfileInit(uint);
+extern  uint            ProfileOptSize(sym_handle);
+extern  void            ProfileFini(void);
 extern  void            CGMemInit(void);
 extern  void            InitSegDefs(void);
 extern  void            InitDbgInfo(void);
@@ -75,6 +78,7 @@ extern  void            AbortCG(void);
 extern  void            FiniDbgInfo(void);
 extern  void            TFini(void);
 extern  void            CGMemFini(void);
+extern  pointer_int     MemInUse(void);
 extern  seg_id          SetOP(seg_id);
 extern  void            FlushOP(seg_id);
 extern  bool            AskSegROM(segment_id);
@@ -227,6 +231,7 @@ extern  cg_init_info _CGAPI     BEInitCg( cg_switches switches,
 #endif
     CGProcessorVersion = proc;
     InitWeights( optsize );
+    ProfileInit( optsize );
     InitSegDefs();
     InitDbgInfo();
     TypeInit();
@@ -324,6 +329,7 @@ extern  void _CGAPI     BEFiniCg( void )
     EchoAPIFini();
 #endif
     FreeBckInfoCarveBlocks();
+    ProfileFini();
     FiniDbgInfo();
     TypeFini();
     TFini();
@@ -343,6 +349,12 @@ extern  bool _CGAPI     BEMoreMem( void )
     return( _MemCheck( 1 ) );
 }
 
+extern  unsigned_32 _CGAPI      BEMemInUse( void )
+/************************************************/
+{
+    return( MemInUse() );
+}
+
 extern  segment_id _CGAPI       BESetSeg( segment_id seg )
 /********************************************************/
 {
@@ -673,6 +685,8 @@ extern  uint _CGAPI     BETypeAlign( cg_type tipe )
 extern  void _CGAPI     CGProcDecl( pointer name, cg_type tipe )
 /**************************************************************/
 {
+    uint        optsize;
+
 #ifndef NDEBUG
     EchoAPI( "\n" );
     EchoAPI( "CGProcDecl( %s, %t )\n", name, tipe );
@@ -680,6 +694,11 @@ extern  void _CGAPI     CGProcDecl( pointer name, cg_type tipe )
     if( BGInInline() ) {
         BGProcInline( name, TypeAddress( tipe ) );
     } else {
+        optsize = ProfileOptSize( name );
+        if( optsize != OptForSize ) {
+            OptForSize = optsize;
+            InitWeights( optsize );
+        }
         TellObjNewProc( name );
         BGProcDecl( name, TypeAddress( tipe ) );
     }
@@ -52,6 +52,8 @@ extern  proc_def        *CurrProc;
 extern  global_bit_set  MemoryBits;
 extern  bool            HaveLiveInfo;
 
+static  gbit_scratch    Alive;          /* out_of_block part of FlowConflicts' alive */
+
 
 static  void            GlobalConflictsFirst( void )
 /***************************************************
@@ -231,6 +233,34 @@ extern  void    NowDead( name *opnd, conflict_node *conf,
 }
 
 
+static  void    FlowAlive( name *opnd, conflict_node *conf,
+                           name_set *alive, block *blk )
+/*********************************************************/
+{
+    if( opnd->n.class != N_REGISTER && conf != NULL
+     && ( opnd->v.usage & USE_IN_ANOTHER_BLOCK ) ) {
+        GBitScratchOn( &Alive, conf->id.out_of_block );
+    } else {
+        NowAlive( opnd, conf, alive, blk );
+    }
+}
+
+
+static  void    FlowDead( name *opnd, conflict_node *conf,
+                          name_set *alive, block *blk )
+/********************************************************/
+{
+    if( opnd->n.class != N_REGISTER && conf != NULL
+     && ( opnd->v.usage & USE_IN_ANOTHER_BLOCK ) ) {
+        if( opnd->n.class != N_TEMP || opnd->t.alias == opnd ) {
+            GBitScratchOff( &Alive, conf->id.out_of_block );
+        }
+    } else {
+        NowDead( opnd, conf, alive, blk );
+    }
+}
+
+
 static  void    FlowConflicts( instruction *first,
                                instruction *last, block *blk )
 /************************************************************/
@@ -248,8 +278,8 @@ static  void    FlowConflicts( instruction *first,
     bool                result_forced_alive;
 
     alive.regs          = last->head.live.regs;
-    alive.out_of_block  = last->head.live.out_of_block;
     alive.within_block  = last->head.live.within_block;
+    GBitScratchLoad( &Alive, last->head.live.out_of_block );
 #if _TARGET & _TARG_AXP
     if( blk == HeadBlock ) {
         HW_TurnOn( alive.regs, CurrProc->state.parm.used );
@@ -280,14 +310,14 @@ static  void    FlowConflicts( instruction *first,
                     opnd = opnd->i.index;
                 }
                 conf = FindConflictNode( opnd, blk, ins );
-                NowAlive( opnd, conf, &alive, blk );
+                FlowAlive( opnd, conf, &alive, blk );
                 ++ i;
             }
         }
         if( ins->head.opcode == OP_CALL
          || ins->head.opcode == OP_CALL_INDIRECT ) {
           /* all memory names are operands of a call instruction*/
-            _GBitTurnOn( alive.out_of_block, MemoryBits );
+            GBitScratchOn( &Alive, MemoryBits );
         }
 
         /*   Move information into current instruction*/
@@ -297,7 +327,8 @@ static  void    FlowConflicts( instruction *first,
         ins->head.live.regs = alive.regs;
         HW_TurnOn( ins->head.live.regs, CurrProc->state.unalterable );
 
-        ins->head.live.out_of_block = alive.out_of_block;
+        ins->head.live.out_of_block =
+            GBitScratchSet( &Alive, ins->head.live.out_of_block );
         ins->head.live.within_block = alive.within_block;
 
         ins = ins->head.prev;
@@ -312,10 +343,10 @@ static  void    FlowConflicts( instruction *first,
         if( opnd != NULL ) {
             if( opnd->n.class == N_INDEXED ) {
                 conf = FindConflictNode( opnd->i.index, blk, ins );
-                NowAlive( opnd->i.index, conf, &alive, blk );
+                FlowAlive( opnd->i.index, conf, &alive, blk );
             } else {
                 conf = FindConflictNode( opnd, blk, ins );
-                NowDead( opnd, conf, &alive, blk );
+                FlowDead( opnd, conf, &alive, blk );
 
                 /* 2007-06-28 RomanT
                  * Force result of volatile instruction to live after it.
@@ -378,6 +409,7 @@ extern  void    MakeLiveInfo( void )
                        (instruction *)&blk->ins, blk );
         ExtendConflicts( blk, first_global );
     }
+    GBitScratchFree( &Alive );
 }
 
 
@@ -395,6 +427,7 @@ extern  void    LiveInfoUpdate( void )
         blk = blk->next_block;
         if( blk == NULL ) break;
     }
+    GBitScratchFree( &Alive );
 }
 
 
@@ -59,6 +59,7 @@ extern  pointer         SafeRecurse( pointer (* rtn)(), pointer arg );
 extern  void            SaveToTargProc(void);
 extern  void            RestoreFromTargProc(void);
 extern  void            InitTargProc(void);
+extern  void            FreeGBits(proc_def*);
 
 
 extern    bool                  BlocksUnTrimmed;
@@ -578,6 +579,7 @@ extern  void    FreeProc( void )
         if( oldproc->state.parm.table ) {
             CGFree( oldproc->state.parm.table );
         }
+        FreeGBits( oldproc );
         CGFree( oldproc );
         if( CurrProc != NULL ) {
             RestoreFromTargProc();
@@ -115,6 +115,7 @@ extern  instruction     *NewIns( int num ) {
     memset( &new->flags, 0, sizeof( new->flags ) );
     new->ins_flags = 0;
     new->head.line_num = 0;
+    _GBitInit( new->head.live.out_of_block, EMPTY );
     new->sequence = 0;
     new->stk_entry = 0;
     new->stk_exit = 0;
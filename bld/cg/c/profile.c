@@ -0,0 +1,233 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Per-routine optimization choices from a sampling profile.
+*
+****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "standard.h"
+#include "cgdefs.h"
+#include "cgmem.h"
+#include "cg.h"
+#include "cgaux.h"
+#include "bckdef.h"
+#include "feprotos.h"
+
+/*
+ * The profile is what wprof writes when asked to convert a wsample run
+ * to comma delimited text, one line per routine:
+ *
+ *      "image","module","file","routine","count"
+ *
+ * count being the number of samples that fell in the routine. Routines
+ * that got at least 1/HOT_SHARE of all the samples are compiled for
+ * speed and routines listed without a single sample are compiled for
+ * size, whatever -os/-ot asked for; that decides the code the routine
+ * gets and the register allocator's weighting of size against time.
+ * Routines the profile doesn't list (new code, other programs) get the
+ * command line setting.
+ */
+
+#define HOT_SHARE       200
+#define HASH_SIZE       251
+#define MAX_LINE        1024
+
+typedef struct prof_rtn {
+        struct prof_rtn         *next;
+        unsigned_32             count;
+        char                    *file;          /* base name of source file */
+        char                    name[1];
+} prof_rtn;
+
+extern  char            *CopyStr(char*,char*);
+
+static  prof_rtn        *ProfHash[ HASH_SIZE ];
+static  unsigned_32     ProfTotal;
+static  uint            UserOptSize;
+static  char            *SourceFile;
+
+
+static  unsigned        HashName( char *name )
+/********************************************/
+{
+    unsigned            hash;
+
+    hash = 0;
+    while( *name != '\0' ) {
+        hash = hash * 31 + (unsigned char)*name++;
+    }
+    return( hash % HASH_SIZE );
+}
+
+
+static  char    *BaseName( char *path )
+/*************************************/
+{
+    char                *base;
+
+    base = path;
+    while( *path != '\0' ) {
+        if( *path == '/' || *path == '\\' || *path == ':' ) {
+            base = path + 1;
+        }
+        ++path;
+    }
+    return( base );
+}
+
+
+static  bool    AddLine( char *line )
+/***********************************/
+/* split up one line, quotes and all; routine names may have commas */
+{
+    char                *field[ 4 ];
+    char                *sep;
+    char                *last;
+    prof_rtn            *rtn;
+    unsigned            hash;
+    int                 i;
+
+    if( *line != '"' ) return( FALSE );
+    field[ 0 ] = line + 1;
+    for( i = 1; i < 4; ++i ) {
+        sep = strstr( field[ i - 1 ], "\",\"" );
+        if( sep == NULL ) return( FALSE );
+        *sep = '\0';
+        field[ i ] = sep + 3;
+    }
+    last = NULL;
+    for( sep = field[ 3 ]; (sep = strstr( sep, "\",\"" )) != NULL; ++sep ) {
+        last = sep;
+    }
+    if( last == NULL ) return( FALSE );
+    *last = '\0';
+    field[ 2 ] = BaseName( field[ 2 ] );
+    rtn = CGAlloc( sizeof( prof_rtn ) + strlen( field[ 3 ] )
+                   + strlen( field[ 2 ] ) + 1 );
+    CopyStr( field[ 3 ], rtn->name );
+    rtn->file = rtn->name + strlen( field[ 3 ] ) + 1;
+    CopyStr( field[ 2 ], rtn->file );
+    rtn->count = strtoul( last + 3, NULL, 10 );
+    hash = HashName( rtn->name );
+    rtn->next = ProfHash[ hash ];
+    ProfHash[ hash ] = rtn;
+    ProfTotal += rtn->count;
+    return( TRUE );
+}
+
+
+extern  void    ProfileInit( uint optsize )
+/*****************************************/
+{
+    char                *name;
+    char                line[ MAX_LINE ];
+    FILE                *fp;
+
+    UserOptSize = optsize;
+    ProfTotal = 0;
+    memset( ProfHash, 0, sizeof( ProfHash ) );
+    name = FEAuxInfo( NULL, PROFILE_NAME );
+    if( name == NULL ) return;
+    fp = fopen( name, "r" );
+    if( fp == NULL ) {
+        FEMessage( MSG_INFO_FILE, "unable to read profile; ignored" );
+        return;
+    }
+    while( fgets( line, sizeof( line ), fp ) != NULL ) {
+        line[ strcspn( line, "\r\n" ) ] = '\0';
+        AddLine( line );
+    }
+    fclose( fp );
+    name = FEAuxInfo( NULL, SOURCE_NAME );
+    if( name != NULL ) {
+        name = BaseName( name );
+        SourceFile = CGAlloc( strlen( name ) + 1 );
+        CopyStr( name, SourceFile );
+    }
+}
+
+
+static  prof_rtn        *FindRoutine( char *name )
+/************************************************/
+/* a static routine may have namesakes, so the file has to pick one */
+{
+    prof_rtn            *rtn;
+    prof_rtn            *found;
+    int                 matches;
+
+    found = NULL;
+    matches = 0;
+    for( rtn = ProfHash[ HashName( name ) ]; rtn != NULL; rtn = rtn->next ) {
+        if( strcmp( rtn->name, name ) != 0 ) continue;
+        if( SourceFile != NULL && stricmp( rtn->file, SourceFile ) == 0 ) {
+            return( rtn );
+        }
+        found = rtn;
+        ++matches;
+    }
+    if( matches != 1 ) return( NULL );
+    return( found );
+}
+
+
+extern  uint    ProfileOptSize( sym_handle sym )
+/**********************************************/
+{
+    prof_rtn            *rtn;
+
+    if( ProfTotal == 0 ) return( UserOptSize );
+    rtn = FindRoutine( FEName( sym ) );
+    if( rtn == NULL ) return( UserOptSize );
+    if( rtn->count == 0 ) return( 100 );
+    if( rtn->count >= ProfTotal / HOT_SHARE ) return( 0 );
+    return( UserOptSize );
+}
+
+
+extern  void    ProfileFini( void )
+/*********************************/
+{
+    prof_rtn            *rtn;
+    prof_rtn            *next;
+    int                 i;
+
+    for( i = 0; i < HASH_SIZE; ++i ) {
+        for( rtn = ProfHash[ i ]; rtn != NULL; rtn = next ) {
+            next = rtn->next;
+            CGFree( rtn );
+        }
+        ProfHash[ i ] = NULL;
+    }
+    if( SourceFile != NULL ) {
+        CGFree( SourceFile );
+        SourceFile = NULL;
+    }
+    ProfTotal = 0;
+}
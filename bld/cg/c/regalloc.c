@@ -181,8 +181,8 @@ static  void    AssignMoreBits( void )
 /*************************************
     Run through the list of conflicts and turn off the CONFLICT_ON_HOLD
     bit.  This is on for conflicts that needed an id bit but didn't get
-    one.  MoreConflicts will assign a bit to any of these that weren't
-    allocated the first time around.
+    one.  Global bits never run out, so these are all waiting for a
+    local bit, which LiveInfoUpdate will hand out again.
 */
 {
     conflict_node       *conf;
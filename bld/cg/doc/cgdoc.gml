@@ -226,6 +226,10 @@ is generated.
 :DD.Generate FWAIT instructions on 386 and later CPUs. The 386 never needs
 FWAIT for data synchronization, but FWAIT may still be needed for accurate
 exception reporting.
+:DT.SSE2_CONVERT
+:DD.Use the SSE2 CVTTSS2SI and CVTTSD2SI instructions to truncate float and
+double values to integers instead of calling a routine to change the 8087
+rounding mode (386 only).
 :eDL.
 :DL tsize='2i'.
 :DTHD.RISC Switch
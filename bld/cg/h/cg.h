@@ -181,9 +181,20 @@ typedef enum {
         MSG_SCHEDULER_DIED,     /*  ins scheduler ran out of mem (sym) */
         MSG_NO_SEG_REGS,        /*  accessing far memory with no seg regs */
         MSG_BAD_PEG_REG,        /*  bad register pegged to a segment */
-        MSG_SYMBOL_TOO_LONG     /*  symbol too long, truncated (sym) */
+        MSG_SYMBOL_TOO_LONG,    /*  symbol too long, truncated (sym) */
+        MSG_PHASE               /*  entering code generator phase (cg_phase) */
 } msg_class;                    /*  fatal cg error message */
 
+typedef enum {
+        PHASE_FRONT_END,        /*  returned to the front end */
+        PHASE_OPTIMIZE,         /*  flow graph, CSE, conflicts, peephole */
+        PHASE_LOOP_OPT,         /*  loop optimizations */
+        PHASE_REG_ALLOC,        /*  register allocation */
+        PHASE_SCHEDULE,         /*  instruction scheduling */
+        PHASE_ENCODE,           /*  prolog/epilog, encoding, peephole queue */
+        PHASE_OBJECT            /*  writing the object file */
+} cg_phase;                     /*  parm of MSG_PHASE */
+
 #define DBG_NIL_TYPE    0
 #define DBG_FWD_TYPE    0xffffffff
 #define SEG_EXTRN_FAR   0x80
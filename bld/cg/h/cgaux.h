@@ -56,7 +56,7 @@ typedef enum {
         DBG_PREDEF_SYM,
         DBG_PCH_SYM,
         DBG_SYM_ACCESS,
-        __UNUSED_AUX_CLASS_13,
+        PROFILE_NAME,
         __UNUSED_AUX_CLASS_14,
         __UNUSED_AUX_CLASS_15,
         __UNUSED_AUX_CLASS_16,
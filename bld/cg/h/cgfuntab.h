@@ -210,3 +210,4 @@ CGAPIDEF( DBEndBlock,   void,           (void) )
 CGAPIDEF( DFClient,     pointer,        (void) )
 CGAPIDEF( DFDwarfLocal, void,           (pointer,pointer,pointer) )
 CGAPIDEF( CGSafeRecurse,pointer,        (pointer,pointer) )
+CGAPIDEF( BEMemInUse,   unsigned_32,    (void) )
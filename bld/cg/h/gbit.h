@@ -0,0 +1,98 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Global (cross block) bit sets used by the data flow
+*               analysis and the register allocator.
+*
+****************************************************************************/
+
+
+/*
+ * A global_bit_set points to an immutable, sorted list of the non-zero
+ * 32-bit words of the set, so a function may use any number of bits and
+ * a set only costs as much as the words it has bits in. NULL is the empty
+ * set. Sets are never changed once built: the operations below return a
+ * new set (or one of their operands when the result is the same), which
+ * keeps the plain assignment and copying of these sets done all over the
+ * code generator working as it did with the old fixed size structs.
+ *
+ * Sets are allocated on behalf of the current procedure and all go away
+ * together when it is freed; see FreeGBits(). Loops that rebuild a set
+ * many times over (the live analysis) keep it in a gbit_scratch instead,
+ * which is changed in place and only turned into a real set when it is
+ * stored, so the intermediate sets are never allocated.
+ */
+
+#ifndef A_BIT_SET_DEFINED
+typedef unsigned a_bit_set;
+#define A_BIT_SET_DEFINED
+#endif
+
+typedef struct gbit_word {
+        unsigned                index;          /* word number, bits 32*index.. */
+        a_bit_set               bits;           /* never zero */
+} gbit_word;
+
+typedef struct gbit_set {
+        unsigned                count;
+        gbit_word               word[1];        /* count words, by index */
+} gbit_set;
+
+typedef gbit_set                *global_bit_set;
+
+typedef struct gbit_scratch {
+        a_bit_set               *bits;          /* words 0..size-1 */
+        unsigned                size;
+        global_bit_set          set;            /* same bits, if !changed */
+        bool                    changed;
+} gbit_scratch;
+
+extern  global_bit_set  GBitUnion( global_bit_set, global_bit_set );
+extern  global_bit_set  GBitDiff( global_bit_set, global_bit_set );
+extern  global_bit_set  GBitIntersect( global_bit_set, global_bit_set );
+extern  bool            GBitOverlap( global_bit_set, global_bit_set );
+extern  bool            GBitSame( global_bit_set, global_bit_set );
+extern  global_bit_set  GBitSingle( unsigned );
+extern  void            GBitNext( global_bit_set * );
+extern  void            GBitIter( void (*)( unsigned_32 ), global_bit_set );
+extern  void            GBitScratchLoad( gbit_scratch *, global_bit_set );
+extern  void            GBitScratchOn( gbit_scratch *, global_bit_set );
+extern  void            GBitScratchOff( gbit_scratch *, global_bit_set );
+extern  global_bit_set  GBitScratchSet( gbit_scratch *, global_bit_set );
+extern  void            GBitScratchFree( gbit_scratch * );
+
+/* there is no "all bits" set, so val must be EMPTY */
+#define _GBitInit( set, val )           ( (set) = NULL )
+#define _GBitAssign( dst, src )         ( (dst) = (src) )
+#define _GBitEmpty( set )               ( (set) == NULL )
+#define _GBitFirst( set )               ( (set) = GBitSingle( 0 ) )
+#define _GBitNext( setp )               GBitNext( setp )
+#define _GBitIter( routine, set )       GBitIter( routine, set )
+#define _GBitOverlap( a, b )            GBitOverlap( a, b )
+#define _GBitSame( a, b )               ( (a) == (b) || GBitSame( a, b ) )
+#define _GBitTurnOn( a, b )             ( (a) = GBitUnion( a, b ) )
+#define _GBitTurnOff( a, b )            ( (a) = GBitDiff( a, b ) )
+#define _GBitIntersect( a, b )          ( (a) = GBitIntersect( a, b ) )
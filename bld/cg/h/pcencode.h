@@ -82,6 +82,7 @@ extern void     Format(oc_class);
 #define M_SECONDARY     0x0f
 #define M_386MUL        0xaf
 #define M_SETCC         0x90
+#define M_CVTTSD2SI     0x2c
 
 /* structures and shift positions for instructions*/
 
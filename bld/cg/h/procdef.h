@@ -95,4 +95,5 @@ typedef struct proc_def {
         union  name             *lasttemp;
         union  name             *dummy_index;
         instruction             *parms_list;
+        pointer                 gbit_chunks;    /* see gbitset.c */
 } proc_def;
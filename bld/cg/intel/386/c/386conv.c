@@ -39,6 +39,7 @@
 #include "model.h"
 #include "funits.h"
 #include "makeins.h"
+#include "gen8087.h"
 
 extern  name            *AllocTemp( type_class_def );
 extern  void            MoveSegOp( instruction *, instruction *, int );
@@ -225,6 +226,15 @@ static  opcode_entry    CRtn[] = {
 _Un( ANY,  ANY,  NONE ),     V_NO,           R_MAKECALL,     RG_,   FU_NO,
 };
 
+static  opcode_entry    CvtSSE2[] = {
+/***********************************/
+/*    from  to    eq          verify          gen             reg   fu*/
+_Un( M,    R,    NONE ),     V_NO,           G_SSECVT,       RG_DBL,FU_FCVT,
+_Un( M,    M,    NONE ),     V_NO,           R_MOVRESREG,    RG_DBL,FU_NO,
+_Un( R|C,  ANY,  NONE ),     V_NO,           R_CVTOP1MEM,    RG_,   FU_NO,
+_Un( ANY,  ANY,  NONE ),     V_NO,           G_UNKNOWN,      RG_8087_DBL_NEED,FU_NO,
+};
+
 static opcode_entry     *CvtAddr[] = {
         C2to1,
         C4to1,
@@ -353,6 +363,9 @@ extern  instruction     *rDOCVT( instruction *ins )
         new_ins = MakeMove( src, dst, ins->type_class );
         DupSeg(ins,new_ins);
         ReplIns( ins, new_ins );
+    } else if( how == FPOK && _IsSSE2Cvt( ins ) ) {
+        ins->table = CvtSSE2;
+        new_ins = ins;
     } else if( how == FPOK ) {
         ins->head.opcode = OP_MOV;
         ins->table = NULL;
@@ -39,6 +39,7 @@ RG( RL_STI,    RL_STI,    RL_STI,    RL_,    RL_DOUBLE,RG_8087_NEED ),
 RG( RL_STI,    RL_,       RL_8,      RL_,    RL_,      RG_8087_8 ),
 RG( RL_STI,    RL_STI,    RL_STI,    RL_EAX, RL_,      RG_8087_ZAP_ACC ),
 RG( RL_STI,    RL_,       RL_DOUBLE, RL_,    RL_,      RG_8087_DBL ),
+RG( RL_STI,    RL_,       RL_DOUBLE, RL_,    RL_DOUBLE,RG_8087_DBL_NEED ),
 RG( RL_8,      RL_,       RL_STI,    RL_,    RL_,      RG_8_8087 ),
 RG( RL_8,      RL_8,      RL_8,      RL_,    RL_DOUBLE,RG_8_NEED_DBL ),
 RG( RL_DOUBLE, RL_,       RL_STI,    RL_,    RL_,      RG_DBL_8087 ),
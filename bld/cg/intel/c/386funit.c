@@ -66,6 +66,7 @@ static const FU_entry FUnits486[] = {
    {F_FOP,                      73,         73},    /* FDIV */
    {F_FOP,                      241,        241},   /* TRIG */
    {F_NONE,                     0,          0},     /* CALL */
+   {F_ALU1,                     1,          4},     /* FCVT */
 };
 
 static const FU_entry FUnits586[] = {
@@ -81,6 +82,7 @@ static const FU_entry FUnits586[] = {
    {F_FOP,                      32,         32},    /* FDIV */
    {F_ALU1,                     69,         69},    /* TRIG */
    {F_NONE,                     0,          0},     /* CALL */
+   {F_ALU1,                     1,          6},     /* FCVT */
 };
 
 
@@ -180,6 +180,200 @@ static  bool    FindFlowOut( block *blk ) {
     return( TRUE );
 }
 
+/* Operands we may read whether or not the condition holds */
+static  bool    SafeToRead( name *op ) {
+/**************************************/
+
+    switch( op->n.class ) {
+    case N_CONSTANT:
+        return( op->c.const_type == CONS_ABSOLUTE );
+    case N_TEMP:
+    case N_MEMORY:
+        return( ( op->v.usage & VAR_VOLATILE ) == 0 );
+    }
+    return( FALSE );
+}
+
+static  instruction     *SetToName( block *blk ) {
+/************************************************/
+
+    instruction *ins;
+    instruction *next;
+
+    ins = blk->ins.hd.next;
+    while( ins->head.opcode == OP_NOP ) {
+        ins = ins->head.next;
+    }
+    if( ins->head.opcode != OP_MOV ) return( NULL );
+    next = ins->head.next;
+    while( next->head.opcode == OP_NOP ) {
+        next = next->head.next;
+    }
+    if( next->head.opcode != OP_BLOCK ) return( NULL );
+    if( !SafeToRead( ins->operands[ 0 ] ) ) return( NULL );
+    return( ins );
+}
+
+static  bool    IsArm( block *blk, block *join ) {
+/************************************************/
+
+    if( blk->inputs != 1 ) return( FALSE );
+    if( blk->targets != 1 ) return( FALSE );
+    if( ( blk->edge[ 0 ].flags & DEST_IS_BLOCK ) == EMPTY ) return( FALSE );
+    return( blk->edge[ 0 ].destination == join );
+}
+
+/* On processors that predict branches, turn
+ *     if( cond ) x = a; else x = b;      or      if( cond ) x = a;
+ * into a branchless select, using the 0/-1 mask made from SETcc:
+ *     x = b + ( -cond & ( a - b ) )      when a and b are constants
+ *     x = b ^ ( -cond & ( a ^ b ) )      otherwise
+ * where b is x itself when there is no else part. This is what picks
+ * min, max and clamps out of data dependent loops, where the branches
+ * mispredict about half the time. Without an else part x gets stored
+ * even when cond is false, which only a temp whose address is not
+ * taken may see; anything else could be looked at by another thread
+ * or a signal handler in between.
+ */
+static  bool    FindSelect( block *blk ) {
+/****************************************/
+
+    instruction         *ins;
+    instruction         *new_ins;
+    instruction         *true_ins;
+    instruction         *false_ins;
+    block               *true;
+    block               *false;
+    block               *join;
+    block_edge          *new_edge;
+    name                *true_op;
+    name                *false_op;
+    name                *u1temp;
+    name                *mask;
+    name                *diff;
+    name                *result;
+    signed_32           konst;
+    type_class_def      class;
+
+    ins = blk->ins.hd.prev;
+    while( !_OpIsCondition( ins->head.opcode ) ) {
+        ins = ins->head.prev;
+    }
+    if( TypeClassSize[ ins->type_class ] > WORD_SIZE ) return( FALSE );
+    if( ( blk->edge[ 0 ].flags & DEST_IS_BLOCK ) == EMPTY ) return( FALSE );
+    if( ( blk->edge[ 1 ].flags & DEST_IS_BLOCK ) == EMPTY ) return( FALSE );
+    true = blk->edge[ _TrueIndex( ins ) ].destination;
+    false = blk->edge[ _FalseIndex( ins ) ].destination;
+    if( IsArm( true, false ) ) {
+        join = false;
+        false = NULL;
+    } else if( IsArm( false, true ) ) {
+        join = true;
+        true = NULL;
+    } else if( IsArm( true, true->edge[ 0 ].destination )
+            && IsArm( false, true->edge[ 0 ].destination ) ) {
+        join = true->edge[ 0 ].destination;
+    } else {
+        return( FALSE );
+    }
+    if( join->inputs != 2 ) return( FALSE );
+    if( join->class & UNKNOWN_DESTINATION ) return( FALSE );
+
+    true_ins = NULL;
+    false_ins = NULL;
+    if( true != NULL ) {
+        true_ins = SetToName( true );
+        if( true_ins == NULL ) return( FALSE );
+    }
+    if( false != NULL ) {
+        false_ins = SetToName( false );
+        if( false_ins == NULL ) return( FALSE );
+    }
+    if( true_ins == NULL ) {
+        result = false_ins->result;
+        class = false_ins->type_class;
+        true_op = result;
+        false_op = false_ins->operands[ 0 ];
+    } else if( false_ins == NULL ) {
+        result = true_ins->result;
+        class = true_ins->type_class;
+        true_op = true_ins->operands[ 0 ];
+        false_op = result;
+    } else {
+        result = true_ins->result;
+        class = true_ins->type_class;
+        if( false_ins->result != result ) return( FALSE );
+        if( false_ins->type_class != class ) return( FALSE );
+        true_op = true_ins->operands[ 0 ];
+        false_op = false_ins->operands[ 0 ];
+    }
+    if( !_IsIntegral( class ) ) return( FALSE );
+    if( TypeClassSize[ class ] > WORD_SIZE ) return( FALSE );
+    if( result->n.class != N_TEMP && result->n.class != N_MEMORY ) return( FALSE );
+    if( !SafeToRead( result ) ) return( FALSE );
+    if( true_ins == NULL || false_ins == NULL ) {
+        if( result->n.class != N_TEMP ) return( FALSE );
+        if( result->v.usage & USE_ADDRESS ) return( FALSE );
+    }
+
+    u1temp = AllocTemp( U1 );
+    mask = AllocTemp( class );
+    ins->result = u1temp;
+    new_ins = MakeConvert( u1temp, mask, class, U1 );
+    SuffixIns( ins, new_ins );
+    ins = new_ins;
+    new_ins = MakeUnary( OP_NEGATE, mask, mask, class );
+    SuffixIns( ins, new_ins );
+    ins = new_ins;
+    if( true_op->n.class == N_CONSTANT && false_op->n.class == N_CONSTANT ) {
+        konst = true_op->c.int_value - false_op->c.int_value;
+        if( TypeClassSize[ class ] < 4 ) {
+            konst &= ( 1L << ( TypeClassSize[ class ] * 8 ) ) - 1;
+        }
+        new_ins = MakeBinary( OP_AND, mask, AllocS32Const( konst ), mask, class );
+        SuffixIns( ins, new_ins );
+        ins = new_ins;
+        if( false_op->c.int_value != 0 ) {
+            new_ins = MakeBinary( OP_ADD, mask, false_op, result, class );
+        } else {
+            new_ins = MakeMove( mask, result, class );
+        }
+    } else {
+        diff = AllocTemp( class );
+        new_ins = MakeBinary( OP_XOR, true_op, false_op, diff, class );
+        SuffixIns( ins, new_ins );
+        ins = new_ins;
+        new_ins = MakeBinary( OP_AND, mask, diff, mask, class );
+        SuffixIns( ins, new_ins );
+        ins = new_ins;
+        new_ins = MakeBinary( OP_XOR, mask, false_op, result, class );
+    }
+    SuffixIns( ins, new_ins );
+
+    RemoveInputEdge( join->input_edges );
+    RemoveInputEdge( join->input_edges );
+    if( true != NULL ) {
+        RemoveInputEdge( true->input_edges );
+        true->targets = 0;
+        RemoveBlock( true );
+    }
+    if( false != NULL ) {
+        RemoveInputEdge( false->input_edges );
+        false->targets = 0;
+        RemoveBlock( false );
+    }
+
+    blk->targets = 1;
+    new_edge = &blk->edge[ 0 ];
+    new_edge->destination = join;
+    new_edge->next_source = NULL;
+    join->input_edges = new_edge;
+    join->inputs = 1;
+    blk->class &= ~CONDITIONAL;
+    blk->class |= JUMP;
+    return( TRUE );
+}
+
 extern  bool    SetOnCondition( void ) {
 /********************************/
 
@@ -191,7 +385,11 @@ extern  bool    SetOnCondition( void ) {
     change = FALSE;
     while( blk != NULL ) {
         if( blk->class & CONDITIONAL ) {
-            change |= FindFlowOut( blk );
+            if( FindFlowOut( blk ) ) {
+                change = TRUE;
+            } else if( _CPULevel( CPU_686 ) ) {
+                change |= FindSelect( blk );
+            }
         }
         blk = blk->next_block;
     }
@@ -1443,6 +1443,20 @@ extern  void    GenObjCode( instruction *ins ) {
             LayRegOp( result );
             AddToTemp( M_SECONDARY );
             break;
+#if _TARGET & _TARG_80386
+        case G_SSECVT:
+            /* CVTTSS2SI/CVTTSD2SI reg,mem */
+            if( ins->base_type_class == FS ) {
+                AddToTemp( M_REPE );
+            } else {
+                AddToTemp( M_REPNE );
+            }
+            LayOpword( M_CVTTSD2SI );
+            LayModRM( left );
+            LayRegOp( result );
+            AddToTemp( M_SECONDARY );
+            break;
+#endif
         default:
             _Zoiks( ZOIKS_028 );
             break;
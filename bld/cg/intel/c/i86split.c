@@ -194,6 +194,7 @@ extern  instruction             *rMOVE8LOW( instruction * );
 extern  instruction             *rCMPCP( instruction * );
 extern  instruction             *rMOVPTI8( instruction * );
 extern  instruction             *rMOVI8PT( instruction * );
+extern  instruction             *rCVTOP1MEM( instruction * );
 
 /* forward declaration */
 extern  void                    CnvOpToInt( instruction * ins, int op );
@@ -743,6 +744,25 @@ extern instruction      *rMOVOP1MEM( instruction *ins ) {
 }
 
 
+extern instruction      *rCVTOP1MEM( instruction *ins ) {
+/******************************************************/
+/* force the floating point operand of an SSE2 conversion into memory */
+
+    instruction         *new_ins;
+    name                *temp;
+    type_class_def      class;
+
+    class = _OpClass( ins );
+    temp = AllocTemp( class );
+    temp->v.usage |= USE_MEMORY | NEEDS_MEMORY;
+    new_ins = MakeMove( ins->operands[ 0 ], temp, class );
+    ins->operands[ 0 ] = temp;
+    MoveSegOp( ins, new_ins, 0 );
+    PrefixIns( ins, new_ins );
+    return( new_ins );
+}
+
+
 extern instruction      *rOP1CMEM( instruction *ins ) {
 /*********************************************************/
 
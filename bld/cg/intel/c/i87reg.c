@@ -373,7 +373,7 @@ static  void    FPConvert( void ) {
         while( ins->head.opcode != OP_BLOCK ) {
             next = ins->head.next;
             if( ins->head.opcode == OP_CONVERT ) {
-                if( _Is87Ins( ins ) ) {
+                if( _Is87Ins( ins ) && !_IsSSE2Cvt( ins ) ) {
                     CnvOperand( ins );
                     CnvResult( ins );
                 }
@@ -57,7 +57,8 @@
 #define NULL_SELECTOR_BAD       0x04000000L     /* Avoid null selectors on i86 */
 #define P5_PROFILING_CTR0       0x08000000L     /* Use RDPMC instead of RDTSC */
 #define GEN_FWAIT_386           0x10000000L     /* Generate FWAITs on 386 and up */
-#define LAST_TARG_CGSWITCH      0x10000000L
+#define SSE2_CONVERT            0x20000000L     /* SSE2 float to int truncation */
+#define LAST_TARG_CGSWITCH      0x20000000L
 
 
 typedef enum {
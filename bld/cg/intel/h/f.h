@@ -41,3 +41,4 @@ _F_( FU_FMUL ),
 _F_( FU_FDIV ),
 _F_( FU_TRIG ),
 _F_( FU_CALL ),
+_F_( FU_FCVT ),
@@ -132,6 +132,7 @@ _G_( G_PUSHFS ),
 _G_( G_POW2DIV ),
 _G_( G_POW2DIV_286 ),
 _G_( G_DIV2 ),
+_G_( G_SSECVT ),
 #define FIRST_8087_2      G_FMATH
 _G_( G_FMATH ),
 _G_( G_IFUNC ),
@@ -51,3 +51,14 @@ typedef enum {
 
 #define _Is87Ins( ins ) ( _IsFloating( (ins)->type_class ) \
                        || _IsFloating( (ins)->base_type_class ) )
+
+/* float to int truncations done by CVTTSS2SI/CVTTSD2SI instead of the 8087 */
+#if _TARGET & _TARG_80386
+#define _IsSSE2Cvt( ins ) ( _IsTargetModel( SSE2_CONVERT ) \
+                       && (ins)->head.opcode == OP_CONVERT \
+                       && (ins)->type_class == I4 \
+                       && ( (ins)->base_type_class == FS \
+                         || (ins)->base_type_class == FD ) )
+#else
+#define _IsSSE2Cvt( ins ) FALSE
+#endif
@@ -130,3 +130,4 @@ _R_( R_MOVE8LOW,        rMOVE8LOW ),
 _R_( R_CMPCP,           rCMPCP ),
 _R_( R_MOVPTI8,         rMOVPTI8 ),
 _R_( R_MOVI8PT,         rMOVI8PT ),
+_R_( R_CVTOP1MEM,       rCVTOP1MEM ),
@@ -0,0 +1,46 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Processor features detected at startup (386 only).
+*
+****************************************************************************/
+
+
+#ifndef _CPUFEAT_H_INCLUDED
+#define _CPUFEAT_H_INCLUDED
+
+#define CPU_CPUID       0x0001      /* CPUID instruction available */
+#define CPU_MMX         0x0002      /* MMX instructions */
+#define CPU_SSE         0x0004      /* SSE, and the OS saves XMM state */
+#define CPU_SSE2        0x0008      /* SSE2, and the OS saves XMM state */
+
+/*
+ * Filled in by an initializer in cpufeat.c; zero until it has run, so
+ * code called earlier in startup takes the plain 386 paths.
+ */
+extern unsigned __cpu_features;
+
+#endif
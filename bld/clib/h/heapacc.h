@@ -55,5 +55,14 @@
     #define _AccessNHeap()
     #define _ReleaseNHeap()
 #endif
+
+/* hooks for the per-thread heap caches in heap/c/tcache.c */
+#if defined(__386__) && ( defined(__NT__) || defined(__LINUX__) )
+    #define __THREAD_HEAP__
+    extern void _WCNEAR *(*__ThreadHeapAlloc)( size_t );
+    extern int          (*__ThreadHeapFree)( void _WCNEAR * );
+    extern void         (*__ThreadHeapFlush)( void );
+    extern void         (*__ThreadHeapFini)( void );
+#endif
 #endif
 
@@ -0,0 +1,180 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Linux thread control blocks, atomic operations and futexes.
+*
+****************************************************************************/
+
+
+#ifndef _LNXTHRD_H_INCLUDED
+#define _LNXTHRD_H_INCLUDED
+
+#include "variety.h"
+#include "thread.h"
+#include "extfunc.h"
+#include "linuxsys.h"
+
+/*
+ * Every thread the library starts has a control block, and %gs selects
+ * a TLS descriptor whose base is that block, so gs:[0] always holds the
+ * address of the running thread's own block. The descriptor comes from
+ * set_thread_area() for the main thread and from clone() for the others.
+ *
+ * The other Linux targets have no such support yet and stay
+ * single-threaded: every caller sees the main thread's block and the
+ * locks do nothing.
+ */
+
+#define LNX_MAX_KEYS        128     /* pthread_key_create() slots */
+#define LNX_STACK_SIZE      (2*1024*1024U)
+#define LNX_GUARD_SIZE      4096
+
+/* values of lnx_thread.state */
+#define LNX_JOINABLE        0
+#define LNX_DETACHED        1
+#define LNX_EXITED          2       /* joinable and gone, not joined yet */
+#define LNX_JOINING         3
+
+#define FUTEX_WAIT          0
+#define FUTEX_WAKE          1
+
+typedef void *lnx_start_fn( void * );
+typedef void lnx_key_dtor( void * );
+#if defined(_M_IX86)
+    #pragma aux (__outside_CLIB) lnx_start_fn;
+    #pragma aux (__outside_CLIB) lnx_key_dtor;
+#endif
+
+/* a value is only current while its seq matches the key's, see pthkey.c */
+typedef struct lnx_specific {
+    unsigned            seq;
+    void                *value;
+} lnx_specific;
+
+typedef struct lnx_thread {
+    struct lnx_thread   *self;          /* gs:[0], must be first */
+    thread_data         *tdata;
+    volatile int        tid;            /* cleared by the kernel at exit */
+    volatile int        state;
+    thread_fn           *begin;         /* _beginthread() routine, or */
+    lnx_start_fn        *start;         /* pthread_create() routine */
+    void                *arg;
+    void                *result;
+    void                *stack_low;
+    void                *map;           /* mapping holding stack and block */
+    unsigned            map_size;
+    void                *cleanup;       /* pthread_cleanup_push() chain */
+    void                *heap_cache;    /* see heap/c/tcache.c */
+    struct lnx_thread   *next;          /* on the list of dead threads */
+    lnx_specific        specific[LNX_MAX_KEYS];
+} lnx_thread;
+
+extern lnx_thread   __LinuxMainThread;
+
+/* called by a thread on its way out, once any key has a destructor */
+extern void         (*__LinuxKeyDtors)( lnx_thread *__self );
+
+extern int          __LinuxAllocThread( lnx_thread **__tcb, void *__stack_bottom,
+                                        unsigned __stack_size );
+extern void         __LinuxFreeThread( lnx_thread *__tcb );
+extern int          __LinuxStartThread( lnx_thread *__tcb );
+extern void         __LinuxExitThread( void *__result );
+#if defined(_M_IX86)
+    #pragma aux __LinuxExitThread aborts;
+#endif
+extern void         __LinuxReleaseThread( lnx_thread *__tcb );
+extern void         __LinuxInitMainThread( thread_data *__tdata );
+
+#if defined(__386__)
+
+/* the struct user_desc of set_thread_area() and clone() */
+typedef struct lnx_tls_desc {
+    int                 entry;
+    void                *base;
+    unsigned            limit;
+    unsigned            flags;
+} lnx_tls_desc;
+
+#define LNX_TLS_FLAGS       0x51    /* 32-bit, limit in pages, usable */
+
+/* GDT entry holding the TLS descriptors */
+extern int          __LinuxTLSEntry;
+
+extern lnx_thread *__LinuxSelf( void );
+#pragma aux __LinuxSelf =               \
+        "mov    eax,gs:[0]"             \
+        value [eax]                     \
+        modify exact [eax];
+
+/* all three are full barriers, and cmpxchg and xadd need a 486 */
+extern int __LinuxXchg( volatile int *, int );
+#pragma aux __LinuxXchg =               \
+        "xchg   [edx],eax"              \
+        parm [edx] [eax]                \
+        value [eax]                     \
+        modify exact [eax];
+
+extern int __LinuxCmpXchg( volatile int *, int, int );
+#pragma aux __LinuxCmpXchg =            \
+        ".486"                          \
+        "lock cmpxchg [edx],ecx"        \
+        parm [edx] [eax] [ecx]          \
+        value [eax]                     \
+        modify exact [eax];
+
+extern int __LinuxXadd( volatile int *, int );
+#pragma aux __LinuxXadd =               \
+        ".486"                          \
+        "lock xadd [edx],eax"           \
+        parm [edx] [eax]                \
+        value [eax]                     \
+        modify exact [eax];
+
+/* "rep nop" is PAUSE on processors that know it */
+extern void __LinuxPause( void );
+#pragma aux __LinuxPause =              \
+        0xf3 0x90                       \
+        modify exact [];
+
+#define __LinuxFutexWait( addr, val, timeout ) \
+        ((int)sys_call4( SYS_futex, (u_long)(addr), FUTEX_WAIT, (val), (u_long)(timeout) ))
+#define __LinuxFutexWake( addr, count ) \
+        ((int)sys_call3( SYS_futex, (u_long)(addr), FUTEX_WAKE, (count) ))
+
+extern void         __LinuxLock( volatile int *__lock );
+extern int          __LinuxTryLock( volatile int *__lock );
+extern void         __LinuxUnlock( volatile int *__lock );
+
+#else
+
+#define __LinuxSelf()                   (&__LinuxMainThread)
+#define __LinuxLock( lock )
+#define __LinuxTryLock( lock )          (1)
+#define __LinuxUnlock( lock )
+
+#endif
+
+#endif
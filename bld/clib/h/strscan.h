@@ -0,0 +1,133 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Helpers for scanning memory a word or a vector at a time.
+*
+****************************************************************************/
+
+
+#ifndef _STRSCAN_H_INCLUDED
+#define _STRSCAN_H_INCLUDED
+
+/*
+ * Nonzero if any byte of the 32-bit word w is zero. It may also flag a
+ * 0x01 byte sitting above a zero one, but never misses the first zero.
+ */
+#define HAS_NUL_BYTE( w )   ( ((w) - 0x01010101UL) & ~(w) & 0x80808080UL )
+
+/* A 32-bit word with every byte set to the low byte of c */
+#define SPREAD_BYTE( c )    ( (unsigned long)(unsigned char)(c) * 0x01010101UL )
+
+#define WORD_ALIGNED( p )   ( ((unsigned)(p) & (sizeof( unsigned long ) - 1)) == 0 )
+
+/*
+ * SSE2 versions are used on the flat 386 targets whose OS saves XMM
+ * state, once cpufeat.c has seen CPU_SSE2. They only ever load aligned
+ * 16-byte blocks, so reading past the end of the data never touches a
+ * page that the data itself does not.
+ */
+#if defined( __386__ ) && ( defined( __NT__ ) || defined( __LINUX__ ) )
+
+#define __SSE2_STRING__
+
+#include "cpufeat.h"
+
+extern size_t __sse2_strlen( const char *__s );
+#pragma aux __sse2_strlen =         \
+        ".686"                      \
+        ".xmm2"                     \
+        "mov      eax,edx"          \
+        "and      eax,0FFFFFFF0h"   /* block holding the first byte */ \
+        "mov      ecx,edx"          \
+        "sub      ecx,eax"          /* bytes before s in that block */ \
+        "pxor     xmm0,xmm0"        \
+        "movdqa   xmm1,[eax]"       \
+        "pcmpeqb  xmm1,xmm0"        \
+        "pmovmskb ebx,xmm1"         \
+        "shr      ebx,cl"           /* ignore nuls before s */ \
+        "test     ebx,ebx"          \
+        "jnz      l_first"          \
+"l_next: add      eax,16"           \
+        "movdqa   xmm1,[eax]"       \
+        "pcmpeqb  xmm1,xmm0"        \
+        "pmovmskb ebx,xmm1"         \
+        "test     ebx,ebx"          \
+        "jz       l_next"           \
+        "bsf      ebx,ebx"          \
+        "add      eax,ebx"          \
+        "sub      eax,edx"          \
+        "jmp      l_done"           \
+"l_first: bsf     eax,ebx"          \
+"l_done:"                           \
+        parm [edx]                  \
+        value [eax]                 \
+        modify exact [eax ebx ecx];
+
+extern void *__sse2_memchr( const void *__s, int __c, size_t __n );
+#pragma aux __sse2_memchr =         \
+        ".686"                      \
+        ".xmm2"                     \
+        "test      ecx,ecx"         \
+        "jz        m_none"          \
+        "movd      xmm0,eax"        \
+        "punpcklbw xmm0,xmm0"       \
+        "punpcklwd xmm0,xmm0"       \
+        "pshufd    xmm0,xmm0,0"     /* c in every byte */ \
+        "mov       esi,edx"         \
+        "add       esi,ecx"         /* esi = end of the data */ \
+        "jnc       m_bounded"       \
+        "or        esi,0FFFFFFFFh"  /* n runs past the top of memory */ \
+"m_bounded: mov    eax,edx"         \
+        "and       eax,0FFFFFFF0h"  \
+        "mov       ecx,edx"         \
+        "sub       ecx,eax"         \
+        "movdqa    xmm1,[eax]"      \
+        "pcmpeqb   xmm1,xmm0"       \
+        "pmovmskb  ebx,xmm1"        \
+        "shr       ebx,cl"          /* drop matches before s ... */ \
+        "shl       ebx,cl"          /* ... keeping block positions */ \
+"m_scan: test      ebx,ebx"         \
+        "jnz       m_found"         \
+        "add       eax,16"          \
+        "cmp       eax,esi"         \
+        "jae       m_none"          \
+        "movdqa    xmm1,[eax]"      \
+        "pcmpeqb   xmm1,xmm0"       \
+        "pmovmskb  ebx,xmm1"        \
+        "jmp       m_scan"          \
+"m_found: bsf      ebx,ebx"         \
+        "add       eax,ebx"         \
+        "cmp       eax,esi"         /* match must be before the end */ \
+        "jb        m_done"          \
+"m_none: xor       eax,eax"         \
+"m_done:"                           \
+        parm [edx] [eax] [ecx]      \
+        value [eax]                 \
+        modify exact [eax ebx ecx edx esi];
+
+#endif
+
+#endif
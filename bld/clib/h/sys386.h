@@ -298,6 +298,20 @@
 #define SYS_sched_setaffinity   241
 #define SYS_sched_getaffinity   242
 #define SYS_set_thread_area     243
+#define SYS_get_thread_area     244
+#define SYS_io_setup            245
+#define SYS_io_destroy          246
+#define SYS_io_getevents        247
+#define SYS_io_submit           248
+#define SYS_io_cancel           249
+#define SYS_fadvise64           250
+#define SYS_exit_group          252
+#define SYS_lookup_dcookie      253
+#define SYS_epoll_create        254
+#define SYS_epoll_ctl           255
+#define SYS_epoll_wait          256
+#define SYS_remap_file_pages    257
+#define SYS_set_tid_address     258
 
 /*
  * internal sub-numbers for SYS_socketcall
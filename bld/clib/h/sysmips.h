@@ -288,6 +288,8 @@ u_long get_a3( void );
 #define SYS_sendfile                4207
 #define SYS_getpmsg                 4208
 #define SYS_putpmsg                 4209
+#define SYS_madvise                 4218
+#define SYS_exit_group              4246
 
 /*
  * internal sub-numbers for SYS_socketcall
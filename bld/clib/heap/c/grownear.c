@@ -53,6 +53,9 @@
 #if defined(__RDOS__)
  #include <rdos.h>
 #endif
+#if defined(__LINUX__)
+ #include <sys/mman.h>
+#endif
 #if defined(__WINDOWS_386__)
  extern void * pascal DPMIAlloc( unsigned long );
 #endif
@@ -510,6 +513,45 @@ static int __CreateNewNHeap( unsigned amount )
 }
 #endif
 
+#if defined(__MAPPED_NHEAP__)
+int __MapNewNHeap( unsigned amount )
+{
+    mheapptr        p1;
+    frlptr          flp;
+    unsigned        size;
+
+    /* the block itself plus the mini-heap descriptor and end tag */
+    size = ( amount + TAG_SIZE + ROUND_SIZE ) & ~ROUND_SIZE;
+    if( size < amount ) return( 0 );
+    amount = size;
+    size += sizeof( struct miniheapblkp ) + TAG_SIZE;
+    if( size < amount ) return( 0 );
+    amount = size;
+    size = ( size + 0x0fff ) & ~0x0fff;
+    if( size < amount ) return( 0 );
+    p1 = mmap( NULL, size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if( p1 == MAP_FAILED ) {
+        return( 0 );
+    }
+    p1->len = size - TAG_SIZE;
+    flp = __LinkUpNewMHeap( p1 );
+    amount = flp->len;
+    /* build a block and free it; not through _nfree(), which would
+       hand the still empty mini-heap straight back to the system */
+    flp->len = amount | 1;
+    ++p1->numalloc;
+    p1->largest_blk = 0;
+    __MemFree( (unsigned)flp + TAG_SIZE, _DGroup(), (unsigned)p1 );
+    if( p1 < __MiniHeapRover ) {
+        if( p1->largest_blk > __LargestSizeB4MiniHeapRover ) {
+            __LargestSizeB4MiniHeapRover = p1->largest_blk;
+        }
+    }
+    return( 1 );
+}
+#endif
+
 int __ExpandDGROUP( unsigned amount )
 {
     #if defined(__WINDOWS_286__) || \
@@ -33,8 +33,8 @@
 #include "variety.h"
 #include <stddef.h>
 #include <malloc.h>
-#include "heap.h"
 #include "heapacc.h"
+#include "heap.h"
 
 
 #if defined(__SMALL_DATA__)
@@ -47,6 +47,9 @@ _WCRTLINK void free( void *stg )
 #endif
 
 struct miniheapblkp _WCNEAR     *__MiniHeapFreeRover;
+#if defined(__MAPPED_NHEAP__)
+static unsigned                 FreedSinceTrim;
+#endif
 
 /* By setting __ALLOC_DEBUG it is possible to spot memory allocation errors in RDOS target */
 
@@ -61,9 +64,28 @@ _WCRTLINK void _nfree( void _WCNEAR *stg )
 
 #else
 
+#if defined(__THREAD_HEAP__)
+
+int     (*__ThreadHeapFree)( void _WCNEAR * );
+
 _WCRTLINK void _nfree( void _WCNEAR *stg )
+{
+    if( !stg )
+        return;
+    if( __ThreadHeapFree != NULL && __ThreadHeapFree( stg ) )
+        return;
+    __NFree( stg );
+}
+
+void __NFree( void _WCNEAR *stg )
+#else
+_WCRTLINK void _nfree( void _WCNEAR *stg )
+#endif
 {
     mheapptr            p1,p2;
+#if defined(__MAPPED_NHEAP__)
+    unsigned            len;
+#endif
 
     if( !stg )
         return;
@@ -125,7 +147,24 @@ _WCRTLINK void _nfree( void _WCNEAR *stg )
 
 found_it:
     // we found the miniheap, free the storage
+#if defined(__MAPPED_NHEAP__)
+    len = *(tag _WCNEAR *)((PTR)stg - TAG_SIZE) & ~1;
+#endif
     __MemFree( (unsigned)stg, _DGroup(), (unsigned) p1 );
+#if defined(__MAPPED_NHEAP__)
+    // an mmap'ed mini-heap goes back as soon as it is empty; elsewhere
+    // the free blocks are trimmed after each megabyte or so of frees
+    if( __IsMappedNHeap( p1 ) && p1->numalloc == 0 ) {
+        __UnmapNHeap( p1 );
+        _ReleaseNHeap();
+        return;
+    }
+    FreedSinceTrim += len;
+    if( FreedSinceTrim >= TRIM_THRESHOLD ) {
+        FreedSinceTrim = 0;
+        __TrimNHeap();
+    }
+#endif
     __MiniHeapFreeRover = p1;
     if( p1 < __MiniHeapRover ) {
         if( p1->largest_blk > __LargestSizeB4MiniHeapRover ) {
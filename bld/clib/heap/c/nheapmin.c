@@ -153,7 +153,14 @@ _WCRTLINK int _nheapshrink( void )
     frlptr last_free;
     frlptr end_tag;
     unsigned new_brk;
+  #if defined(__MAPPED_NHEAP__)
+    mheapptr pnext;
+    mheapptr last_brk;
+  #endif
 
+  #if defined(__THREAD_HEAP__)
+    if( __ThreadHeapFlush != NULL ) __ThreadHeapFlush();
+  #endif
     _AccessNHeap();
     #if defined(__DOS_EXT__)
     if( !_IsRationalZeroBase() && !_IsCodeBuilder() ) {
@@ -162,8 +169,28 @@ _WCRTLINK int _nheapshrink( void )
             _ReleaseNHeap();
             return( 0 ); // No near heap, can't shrink
         }
+  #if defined(__MAPPED_NHEAP__)
+        /* hand back empty mmap'ed mini-heaps, trim the rest */
+        last_brk = NULL;
+        for( mhp = __nheapbeg; mhp != NULL; mhp = pnext ) {
+            pnext = mhp->next;
+            if( !__IsMappedNHeap( mhp ) ) {
+                last_brk = mhp;
+            } else if( mhp->numalloc == 0 ) {
+                __UnmapNHeap( mhp );
+            }
+        }
+        __TrimNHeap();
+        /* only the last mini-heap below the break can shrink */
+        mhp = last_brk;
+        if( mhp == NULL ) {
+            _ReleaseNHeap();
+            return( 0 );
+        }
+  #else
         /* Goto the end of miniheaplist (if there's more than 1 blk) */
         for( mhp = __nheapbeg; mhp->next; mhp = mhp->next );
+  #endif
         /* check that last free block is at end of heap */
         last_free = mhp->freehead.prev;
         end_tag = (frlptr) ( (PTR)last_free + last_free->len );
@@ -220,6 +247,17 @@ _WCRTLINK int _nheapshrink( void )
             new_brk = (unsigned) ((PTR)last_free + TAG_SIZE );
         } else {
             // we can remove this miniheapblk
+          #if defined(__MAPPED_NHEAP__)
+            // mmap'ed mini-heaps may still follow it in the list
+            if( mhp->prev ) {
+                mhp->prev->next = mhp->next;
+            } else {
+                __nheapbeg = mhp->next;
+            }
+            if( mhp->next ) mhp->next->prev = mhp->prev;
+            if( __MiniHeapFreeRover == mhp ) __MiniHeapFreeRover = 0;
+            new_brk = (unsigned)mhp;
+          #else
             if( mhp->prev ) { // Not the first miniheapblk
                 mhp->prev->next = NULL;
                 new_brk = (unsigned)mhp;//->prev + (unsigned)mhp->prev->len;
@@ -227,6 +265,7 @@ _WCRTLINK int _nheapshrink( void )
                 new_brk = (unsigned)__nheapbeg;
                 __nheapbeg = NULL;
             }
+          #endif
             // Update rover info
             if( __MiniHeapRover == mhp ) {
                 __MiniHeapRover = __nheapbeg;
@@ -251,6 +290,9 @@ _WCRTLINK int _nheapshrink( void )
     {
         mheapptr pnext;
 
+      #if defined(__THREAD_HEAP__)
+        if( __ThreadHeapFlush != NULL ) __ThreadHeapFlush();
+      #endif
         _AccessNHeap();
         for( mhp = __nheapbeg; mhp; mhp = pnext ) {
             pnext = mhp->next;
@@ -95,6 +95,12 @@ _WCRTLINK int _nheapwalk( struct _heapinfo *entry )
     {
         int     heap_status;
 
+    #if defined(__THREAD_HEAP__)
+        /* cached blocks would otherwise show up as in use */
+        if( entry->_pentry == NULL && __ThreadHeapFlush != NULL ) {
+            __ThreadHeapFlush();
+        }
+    #endif
         _AccessNHeap();
         heap_status = __NHeapWalk( entry, __nheapbeg );
         _ReleaseNHeap();
@@ -132,7 +132,35 @@ _WCRTLINK void _WCNEAR *_nmalloc( size_t amt )
 
 #else
 
+#if defined(__THREAD_HEAP__)
+
+void _WCNEAR    *(*__ThreadHeapAlloc)( size_t );
+void            (*__ThreadHeapFlush)( void );
+void            (*__ThreadHeapFini)( void );
+
 _WCRTLINK void _WCNEAR *_nmalloc( size_t amt )
+{
+    void _WCNEAR    *ptr;
+
+    if( __ThreadHeapAlloc != NULL ) {
+        ptr = __ThreadHeapAlloc( amt );
+        if( ptr != NULL ) {
+            return( ptr );
+        }
+    }
+    ptr = __NMalloc( amt );
+    if( ptr == NULL && __ThreadHeapFlush != NULL ) {
+        // blocks parked in the caches may be enough
+        __ThreadHeapFlush();
+        ptr = __NMalloc( amt );
+    }
+    return( ptr );
+}
+
+void _WCNEAR *__NMalloc( size_t amt )
+#else
+_WCRTLINK void _WCNEAR *_nmalloc( size_t amt )
+#endif
 {
     unsigned        largest;
     unsigned        size;
@@ -200,6 +228,13 @@ _WCRTLINK void _WCNEAR *_nmalloc( size_t amt )
         } /* forever */
         // OS/2 only - if not block of requested type, will allocate one and find in 2nd pass
         // Try to expand heap and retry
+#if defined(__MAPPED_NHEAP__)
+        // large blocks get a mini-heap of their own
+        if( !expanded && amt >= MMAP_THRESHOLD && __MapNewNHeap( amt ) ) {
+            expanded = 1;
+            continue;
+        }
+#endif
         if( expanded || !__ExpandDGROUP( amt ) ) {
             if( !__nmemneed( amt ) ) {
                 break;                  // give up
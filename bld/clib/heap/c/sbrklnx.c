@@ -40,6 +40,8 @@
 #include "heapacc.h"
 #include "heap.h"
 
+unsigned __brk_start;       /* initial break, bottom of the brk heap */
+
 _WCRTLINK void _WCNEAR *sbrk( int increment ) {
     return( __brk( _curbrk + increment ) );
 }
@@ -64,6 +66,7 @@ _WCRTLINK void _WCNEAR *__brk( unsigned brk_value )
     }
     if ( _curbrk == 0 ) {
         _curbrk = brk_value = sys_brk_value;
+        __brk_start = sys_brk_value;
     }
     
     old_brk_value = _curbrk;        /* return old value of _curbrk */
@@ -0,0 +1,323 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Per-thread caches of small near heap blocks.
+*
+****************************************************************************/
+
+
+#include "dll.h"        // needs to be first
+#include "variety.h"
+#include <stddef.h>
+#include <string.h>
+#include <malloc.h>
+#if defined(__NT__)
+ #include <windows.h>
+#elif defined(__LINUX__)
+ #include "lnxthrd.h"
+#endif
+#include "heapacc.h"
+#include "heap.h"
+#include "thrdheap.h"
+
+/*
+ * Small blocks are kept on per-thread free lists, one per block size,
+ * so malloc() and free() of them normally take no lock at all. The
+ * blocks stay allocated as far as the heap proper is concerned, so
+ * _heapchk() and _msize() work on them unchanged; _heapwalk() and
+ * _heapmin() flush the caches first.
+ *
+ * When a thread's list grows past CACHE_MAX, a batch is pushed on a
+ * shared lock-free "depot" list for that size. A thread whose own list
+ * is empty takes the whole depot list with one exchange before it goes
+ * to the heap, which is where memory freed by one thread gets back to
+ * another. The depot is only ever emptied as a whole, so the pushes do
+ * not suffer from the ABA problem. Beyond DEPOT_MAX blocks, batches are
+ * returned to the heap instead.
+ *
+ * The list links live in the first word of each cached block.
+ */
+
+#define CACHE_LIMIT     256     /* largest block, tag included, cached */
+#define CACHE_GRAIN     (ROUND_SIZE+1)
+#define CACHE_CLASSES   (CACHE_LIMIT/CACHE_GRAIN+1)
+#define CACHE_MAX       64      /* blocks of one size kept per thread */
+#define CACHE_BATCH     32      /* blocks moved to the depot at once */
+#define CACHE_REFILL    16      /* blocks taken from the heap at once */
+#define DEPOT_MAX       1024    /* blocks of one size kept in the depot */
+
+typedef struct cache_blk {
+    struct cache_blk    *next;
+} cache_blk;
+
+typedef struct heap_cache {
+    cache_blk           *list[CACHE_CLASSES];
+    unsigned            count[CACHE_CLASSES];
+} heap_cache;
+
+static cache_blk * volatile depot[CACHE_CLASSES];
+static long volatile        depot_count[CACHE_CLASSES];
+
+/* all three are full barriers, and cmpxchg and xadd need a 486 */
+extern cache_blk *AtomicSwap( cache_blk * volatile *, cache_blk * );
+#pragma aux AtomicSwap =                \
+        "xchg   [edx],eax"              \
+        parm [edx] [eax]                \
+        value [eax]                     \
+        modify exact [eax];
+
+extern cache_blk *AtomicCompareSwap( cache_blk * volatile *, cache_blk *, cache_blk * );
+#pragma aux AtomicCompareSwap =         \
+        ".486"                          \
+        "lock cmpxchg [edx],ecx"        \
+        parm [edx] [eax] [ecx]          \
+        value [eax]                     \
+        modify exact [eax];
+
+extern long AtomicAdd( long volatile *, long );
+#pragma aux AtomicAdd =                 \
+        ".486"                          \
+        "lock xadd [edx],eax"           \
+        parm [edx] [eax]                \
+        value [eax]                     \
+        modify exact [eax];
+
+#if defined(__NT__)
+static DWORD        cache_index = TLS_OUT_OF_INDEXES;
+ #define GET_CACHE()        ((heap_cache *)TlsGetValue( cache_index ))
+ #define SET_CACHE( c )     TlsSetValue( cache_index, (c) )
+#elif defined(__LINUX__)
+ #define GET_CACHE()        ((heap_cache *)__LinuxSelf()->heap_cache)
+ #define SET_CACHE( c )     (__LinuxSelf()->heap_cache = (c))
+#else
+static heap_cache   *main_cache;
+ #define GET_CACHE()        (main_cache)
+ #define SET_CACHE( c )     (main_cache = (c))
+#endif
+
+
+static heap_cache *get_cache( void )
+/**********************************/
+{
+    heap_cache  *cache;
+
+    cache = GET_CACHE();
+    if( cache == NULL ) {
+        cache = __NMalloc( sizeof( heap_cache ) );
+        if( cache != NULL ) {
+            memset( cache, 0, sizeof( heap_cache ) );
+            SET_CACHE( cache );
+        }
+    }
+    return( cache );
+}
+
+/* caller must hold the near heap lock */
+static long free_chain( cache_blk *blk )
+/**************************************/
+{
+    cache_blk   *next;
+    long        n;
+
+    for( n = 0; blk != NULL; blk = next, ++n ) {
+        next = blk->next;
+        __NFree( blk );
+    }
+    return( n );
+}
+
+static cache_blk *refill( heap_cache *cache, unsigned c, size_t amt )
+/*******************************************************************/
+{
+    cache_blk   *blk;
+    cache_blk   *p;
+    unsigned    n;
+
+    blk = AtomicSwap( &depot[c], NULL );
+    if( blk != NULL ) {
+        for( n = 0, p = blk; p != NULL; p = p->next ) {
+            ++n;
+        }
+        AtomicAdd( &depot_count[c], -(long)n );
+    } else {
+        _AccessNHeap();
+        for( n = 0; n < CACHE_REFILL; ++n ) {
+            p = __NMalloc( amt );
+            if( p == NULL )
+                break;
+            p->next = blk;
+            blk = p;
+        }
+        _ReleaseNHeap();
+    }
+    cache->list[c] = blk;
+    cache->count[c] = n;
+    return( blk );
+}
+
+static void release( heap_cache *cache, unsigned c )
+/**************************************************/
+{
+    cache_blk   *keep;
+    cache_blk   *first;
+    cache_blk   *last;
+    cache_blk   *old;
+    long        n;
+
+    /* keep the most recently freed blocks, they are likely still in cache */
+    for( keep = cache->list[c], n = 1; n < CACHE_MAX - CACHE_BATCH; ++n ) {
+        keep = keep->next;
+    }
+    first = keep->next;
+    keep->next = NULL;
+    for( last = first, n = 1; last->next != NULL; ++n ) {
+        last = last->next;
+    }
+    cache->count[c] -= n;
+    if( AtomicAdd( &depot_count[c], n ) >= DEPOT_MAX ) {
+        AtomicAdd( &depot_count[c], -n );
+        _AccessNHeap();
+        free_chain( first );
+        _ReleaseNHeap();
+    } else {
+        do {
+            old = depot[c];
+            last->next = old;
+        } while( AtomicCompareSwap( &depot[c], old, first ) != old );
+    }
+}
+
+static void _WCNEAR *cache_alloc( size_t amt )
+/********************************************/
+{
+    heap_cache  *cache;
+    cache_blk   *blk;
+    unsigned    size;
+    unsigned    c;
+
+    if( amt == 0 || amt > CACHE_LIMIT - TAG_SIZE )
+        return( NULL );
+    size = (amt + TAG_SIZE + ROUND_SIZE) & ~ROUND_SIZE;
+    if( size < FRL_SIZE ) {
+        size = FRL_SIZE;
+    }
+    cache = get_cache();
+    if( cache == NULL )
+        return( NULL );
+    c = size / CACHE_GRAIN;
+    blk = cache->list[c];
+    if( blk == NULL ) {
+        blk = refill( cache, c, size - TAG_SIZE );
+        if( blk == NULL ) {
+            return( NULL );
+        }
+    }
+    cache->list[c] = blk->next;
+    cache->count[c]--;
+    return( blk );
+}
+
+static int cache_free( void _WCNEAR *stg )
+/****************************************/
+{
+    heap_cache  *cache;
+    cache_blk   *blk;
+    tag         len;
+    unsigned    c;
+
+    len = *(tag _WCNEAR *)((PTR)stg - TAG_SIZE);
+    if( (len & 1) == 0 || (len & ~1) > CACHE_LIMIT )
+        return( 0 );
+    cache = get_cache();
+    if( cache == NULL )
+        return( 0 );
+    c = (len & ~1) / CACHE_GRAIN;
+    blk = stg;
+    blk->next = cache->list[c];
+    cache->list[c] = blk;
+    if( ++cache->count[c] > CACHE_MAX ) {
+        release( cache, c );
+    }
+    return( 1 );
+}
+
+/* give back the calling thread's blocks and everything in the depot */
+static void cache_flush( void )
+/*****************************/
+{
+    heap_cache  *cache;
+    unsigned    c;
+
+    cache = GET_CACHE();
+    _AccessNHeap();
+    for( c = 0; c < CACHE_CLASSES; ++c ) {
+        if( cache != NULL ) {
+            free_chain( cache->list[c] );
+            cache->list[c] = NULL;
+            cache->count[c] = 0;
+        }
+        AtomicAdd( &depot_count[c], -free_chain( AtomicSwap( &depot[c], NULL ) ) );
+    }
+    _ReleaseNHeap();
+}
+
+/* the calling thread is going away; threads that end without going */
+/* through __NTRemoveThread() or __LinuxRemoveThread() never get here, */
+/* and their cached blocks stay allocated (see thrdheap.c) */
+static void cache_fini( void )
+/****************************/
+{
+    heap_cache  *cache;
+    unsigned    c;
+
+    cache = GET_CACHE();
+    if( cache == NULL )
+        return;
+    SET_CACHE( NULL );
+    _AccessNHeap();
+    for( c = 0; c < CACHE_CLASSES; ++c ) {
+        free_chain( cache->list[c] );
+    }
+    __NFree( cache );
+    _ReleaseNHeap();
+}
+
+_WCRTLINK void __set_thread_heap( void )
+/**************************************/
+{
+#if defined(__NT__)
+    if( cache_index == TLS_OUT_OF_INDEXES ) {
+        cache_index = TlsAlloc();
+        if( cache_index == TLS_OUT_OF_INDEXES ) {
+            return;
+        }
+    }
+#endif
+    __ThreadHeapFlush = cache_flush;
+    __ThreadHeapFini = cache_fini;
+    __ThreadHeapFree = cache_free;
+    __ThreadHeapAlloc = cache_alloc;
+}
@@ -0,0 +1,99 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Give unused near heap memory back to Linux.
+*
+****************************************************************************/
+
+
+#include "dll.h"        // needs to be first
+#include "variety.h"
+#include <stddef.h>
+#include <malloc.h>
+#include <sys/mman.h>
+#include "heapacc.h"
+#include "heap.h"
+
+#define PAGE_MASK   0x0fffU
+#define TRIM_MIN    (64*1024U)  /* smallest free block worth trimming */
+
+/* caller must hold the near heap lock */
+void __UnmapNHeap( mheapptr mhp )
+/*******************************/
+{
+    mheapptr    pprev;
+    mheapptr    pnext;
+    unsigned    size;
+
+    pprev = mhp->prev;
+    pnext = mhp->next;
+    if( pprev == NULL ) {
+        __nheapbeg = pnext;
+    } else {
+        pprev->next = pnext;
+    }
+    if( pnext != NULL ) pnext->prev = pprev;
+    if( __MiniHeapRover == mhp ) {  // Update rovers
+        if( pnext ) {
+            __MiniHeapRover = pnext;
+        } else {
+            __MiniHeapRover = __nheapbeg;
+            __LargestSizeB4MiniHeapRover = 0;
+        }
+    }
+    if( __MiniHeapFreeRover == mhp ) {
+        __MiniHeapFreeRover = 0;
+    }
+    size = mhp->len + TAG_SIZE;
+    munmap( mhp, size );
+}
+
+/*
+ * Tell the kernel it may drop the pages in the middle of large free
+ * blocks. They stay mapped and come back zero filled when touched, so
+ * nothing in the heap changes; the page holding the free list links
+ * and the one holding the next block's tag are left alone.
+ */
+void __TrimNHeap( void )
+/**********************/
+{
+    mheapptr    mhp;
+    frlptr      flp;
+    unsigned    start;
+    unsigned    end;
+
+    for( mhp = __nheapbeg; mhp != NULL; mhp = mhp->next ) {
+        for( flp = mhp->freehead.next; flp != &mhp->freehead; flp = flp->next ) {
+            if( flp->len < TRIM_MIN )
+                continue;
+            start = ((unsigned)flp + sizeof( frl ) + PAGE_MASK) & ~PAGE_MASK;
+            end = ((unsigned)flp + flp->len) & ~PAGE_MASK;
+            if( start < end ) {
+                madvise( (void *)start, end - start, MADV_DONTNEED );
+            }
+        }
+    }
+}
@@ -146,6 +146,10 @@ extern unsigned int                     __LargestSizeB4MiniHeapRover;
 extern struct miniheapblkp _WCNEAR      *__MiniHeapFreeRover;
 
 extern size_t __LastFree( void );
+#if defined(__THREAD_HEAP__)
+extern void _WCNEAR *__NMalloc( size_t __amt );
+extern void __NFree( void _WCNEAR *__stg );
+#endif
 extern int __NHeapWalk( struct _heapinfo *entry, mheapptr heapbeg );
 extern int __ExpandDGROUP( unsigned int __amt );
 #if defined(_M_IX86)
@@ -170,6 +174,20 @@ extern void _WCFAR __HeapInit( void _WCNEAR *start, unsigned int amount );
 
 _WCRTLINK extern void _WCNEAR *__brk( unsigned );
 
+#if defined(__LINUX__) && defined(__386__)
+// Large requests get mini-heaps of their own from mmap() rather than
+// growing the break; anything outside the brk area is such a mini-heap.
+#define __MAPPED_NHEAP__
+#define MMAP_THRESHOLD      (256*1024U)
+#define TRIM_THRESHOLD      (1024*1024U)
+extern unsigned __brk_start;
+#define __IsMappedNHeap( mhp ) \
+    ((unsigned)(mhp) < __brk_start || (unsigned)(mhp) >= _curbrk)
+extern int  __MapNewNHeap( unsigned __amt );
+extern void __UnmapNHeap( mheapptr __mhp );
+extern void __TrimNHeap( void );
+#endif
+
 #if defined(_M_IX86)
  #define _DGroup()      FP_SEG((&__nheapbeg))
 #else
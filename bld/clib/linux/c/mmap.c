@@ -0,0 +1,51 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Linux mmap() implementation.
+*
+****************************************************************************/
+
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <errno.h>
+#include "linuxsys.h"
+
+_WCRTLINK void *mmap( void *addr, size_t len, int prot, int flags, int fd, off_t offset )
+{
+    u_long  args[6];
+    u_long  res;
+
+    /* the i386 mmap system call takes its arguments in memory */
+    args[0] = (u_long)addr;
+    args[1] = len;
+    args[2] = prot;
+    args[3] = flags;
+    args[4] = fd;
+    args[5] = offset;
+    res = sys_call1( SYS_mmap, (u_long)args );
+    __syscall_return( void *, res );
+}
@@ -24,7 +24,7 @@
 *
 *  ========================================================================
 *
-* Description:  Linux SYS_exit system call.
+* Description:  Linux process exit system call.
 *
 ****************************************************************************/
 
@@ -33,5 +33,8 @@
 
 long sys_exit( int error_code )
 {
+    // SYS_exit only ends the calling thread; kernels that predate
+    // exit_group() return here and have no other threads to end
+    sys_call1( SYS_exit_group, error_code );
     return( sys_call1( SYS_exit, error_code ) );
 }
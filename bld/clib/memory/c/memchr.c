@@ -34,6 +34,9 @@
 #include <string.h>
 #include <wchar.h>
 #include "xstring.h"
+#if defined(__386__) && !defined(__WIDECHAR__)
+ #include "strscan.h"
+#endif
 
 /* locate the first occurrence of c in the initial n characters of the
    object pointed to by s.
@@ -42,7 +45,34 @@
 
 _WCRTLINK VOID_WC_TYPE *__F_NAME(memchr,wmemchr)( const VOID_WC_TYPE *s, INT_WC_TYPE c, size_t n )
 {
-#if defined(__INLINE_FUNCTIONS__) && !defined(__WIDECHAR__) && defined(_M_IX86)
+#if defined(__386__) && !defined(__WIDECHAR__)
+    const unsigned char *cs = s;
+    const unsigned long *w;
+    unsigned long       pattern;
+    unsigned char       ch = c;
+
+  #if defined(__SSE2_STRING__)
+    if( __cpu_features & CPU_SSE2 )
+        return( __sse2_memchr( s, c, n ) );
+  #endif
+    for( ; n && !WORD_ALIGNED( cs ); ++cs, --n ) {
+        if( *cs == ch ) {
+            return( (void *)cs );
+        }
+    }
+    pattern = SPREAD_BYTE( ch );
+    for( w = (const unsigned long *)cs; n >= sizeof( *w ); ++w, n -= sizeof( *w ) ) {
+        if( HAS_NUL_BYTE( *w ^ pattern ) ) {
+            break;
+        }
+    }
+    for( cs = (const unsigned char *)w; n; ++cs, --n ) {
+        if( *cs == ch ) {
+            return( (void *)cs );
+        }
+    }
+    return( NULL );
+#elif defined(__INLINE_FUNCTIONS__) && !defined(__WIDECHAR__) && defined(_M_IX86)
     return( _inline_memchr( s, c, n ) );
 #else
     const CHAR_TYPE *cs = s;
@@ -44,6 +44,18 @@ _WCRTLINK VOID_WC_TYPE *__F_NAME(memcpy,wmemcpy)( VOID_WC_TYPE *in_dst, const VO
     CHAR_TYPE           *dst = in_dst;
     const CHAR_TYPE     *src = in_src;
 
+  #if !defined(__WIDECHAR__)
+    if( ( ( (unsigned)dst | (unsigned)src ) & ( sizeof( unsigned ) - 1 ) ) == 0 ) {
+        unsigned        *wdst = (unsigned *)dst;
+        const unsigned  *wsrc = (const unsigned *)src;
+
+        for( ; len >= sizeof( unsigned ); len -= sizeof( unsigned ) ) {
+            *wdst++ = *wsrc++;
+        }
+        dst = (CHAR_TYPE *)wdst;
+        src = (const CHAR_TYPE *)wsrc;
+    }
+  #endif
     for( ; len; --len ) {
         *dst++ = *src++;
     }
@@ -63,9 +63,26 @@ _WCRTLINK VOID_WC_TYPE *__F_NAME(memset,wmemset)( VOID_WC_TYPE *dst, INT_WC_TYPE
         return( _inline_memset( dst, c, len ) );
     #endif
 #else
-    CHAR_TYPE   *p;
+    CHAR_TYPE   *p = dst;
 
-    for( p = dst; len; --len ) {
+  #if !defined(__WIDECHAR__)
+    if( len >= 2 * sizeof( unsigned ) ) {
+        unsigned    *w;
+        unsigned    pattern;
+
+        for( ; (unsigned)p & ( sizeof( unsigned ) - 1 ); --len ) {
+            *p++ = c;
+        }
+        pattern = (unsigned char)c;
+        pattern |= pattern << 8;
+        pattern |= pattern << ( 4 * sizeof( unsigned ) );
+        for( w = (unsigned *)p; len >= sizeof( unsigned ); len -= sizeof( unsigned ) ) {
+            *w++ = pattern;
+        }
+        p = (CHAR_TYPE *)w;
+    }
+  #endif
+    for( ; len; --len ) {
         *p++ = c;
     }
     return( dst );
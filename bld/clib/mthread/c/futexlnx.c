@@ -0,0 +1,122 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Linux futex locks and the main thread's control block.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include <unistd.h>
+#include "lnxthrd.h"
+#include "exitwmsg.h"
+
+lnx_thread  __LinuxMainThread;
+
+#if defined( __386__ )
+
+/*
+ * The lock word is 0 when free, 1 when held and 2 when held with
+ * (possibly) someone asleep on it, so an uncontended lock and unlock
+ * are one atomic instruction each and never enter the kernel.
+ */
+
+#define LOCK_SPIN       100     /* tries before going to sleep */
+
+int         __LinuxTLSEntry = -1;
+
+extern void SetGS( unsigned );
+#pragma aux SetGS =                     \
+        "mov    gs,ax"                  \
+        parm [eax]                      \
+        modify exact [];
+
+void __LinuxLock( volatile int *lock )
+/************************************/
+{
+    int         c;
+    int         spin;
+
+    for( spin = 0; spin < LOCK_SPIN; ++spin ) {
+        if( *lock == 0 && __LinuxCmpXchg( lock, 0, 1 ) == 0 )
+            return;
+        __LinuxPause();
+    }
+    c = __LinuxXchg( lock, 2 );
+    while( c != 0 ) {
+        __LinuxFutexWait( lock, 2, NULL );
+        c = __LinuxXchg( lock, 2 );
+    }
+}
+
+int __LinuxTryLock( volatile int *lock )
+/**************************************/
+{
+    return( __LinuxCmpXchg( lock, 0, 1 ) == 0 );
+}
+
+void __LinuxUnlock( volatile int *lock )
+/**************************************/
+{
+    if( __LinuxXadd( lock, -1 ) != 1 ) {
+        *lock = 0;
+        __LinuxFutexWake( lock, 1 );
+    }
+}
+
+#endif
+
+void __LinuxInitMainThread( thread_data *tdata )
+/**********************************************/
+{
+    lnx_thread      *self;
+#if defined( __386__ )
+    lnx_tls_desc    desc;
+#endif
+
+    self = &__LinuxMainThread;
+    self->self = self;
+    self->tdata = tdata;
+    self->state = LNX_JOINABLE;
+#if defined( __386__ )
+    // the kernel clears tid when the main thread leaves by pthread_exit()
+    self->tid = sys_call1( SYS_set_tid_address, (u_long)&self->tid );
+    if( self->tid < 0 ) {
+        self->tid = getpid();
+    }
+    desc.entry = -1;
+    desc.base = self;
+    desc.limit = 0xfffff;
+    desc.flags = LNX_TLS_FLAGS;
+    if( sys_call1( SYS_set_thread_area, (u_long)&desc ) != 0 ) {
+        __fatal_runtime_error( "Unable to set up thread-local storage", 1 );
+    }
+    __LinuxTLSEntry = desc.entry;
+    SetGS( desc.entry * 8 + 3 );
+#else
+    self->tid = getpid();
+#endif
+}
@@ -55,6 +55,9 @@
 #endif
 
 extern  void            __FiniThreadProcessing( void );
+#if ( defined( __NT__ ) || defined( __LINUX__ ) ) && defined( __386__ )
+  extern void           (*__ThreadHeapFini)( void );
+#endif
 #if defined( __386__ ) || defined( __AXP__ ) || defined( __PPC__ ) || defined( __MIPS__ )
   extern void           (*_AccessFileH)( int );
   extern void           (*_ReleaseFileH)( int );
@@ -182,7 +185,7 @@ _WCRTLINK void __CloseSemaphore( semaphore_object *obj )
                 #elif defined( __QNX__ )
                     __qsem_destroy( &obj->semaphore );
                 #elif defined( __LINUX__ )
-                    // TODO: Close the semaphore for Linux!
+                    // nothing to free, the futex is just the lock word
                 #elif defined( __RDOS__ )
                     RdosDeleteSection( obj->semaphore );
                     obj->semaphore = 0;
@@ -226,7 +229,7 @@ _WCRTLINK void __AccessSemaphore( semaphore_object *obj )
                         #elif defined( __QNX__ )
                             __qsem_init( &obj->semaphore, 1, 1 );
                         #elif defined( __LINUX__ )
-                            // TODO: Access semaphore under Linux!
+                            obj->semaphore = 0;
                         #elif defined( __RDOS__ )
                             obj->semaphore = RdosCreateSection();
                         #elif defined( __RDOSDEV__ )
@@ -255,7 +258,7 @@ _WCRTLINK void __AccessSemaphore( semaphore_object *obj )
             #elif defined( __QNX__ )
                 __qsem_wait( &obj->semaphore );
             #elif defined( __LINUX__ )
-                // TODO: Wait for semaphore under Linux!
+                __LinuxLock( &obj->semaphore );
             #elif defined( __RDOS__ )
                 RdosEnterSection( obj->semaphore );
             #elif defined( __RDOSDEV__ )
@@ -293,7 +296,7 @@ _WCRTLINK void __ReleaseSemaphore( semaphore_object *obj )
                 #elif defined( __QNX__ )
                     __qsem_post( &obj->semaphore );
                 #elif defined( __LINUX__ )
-                    // TODO: Relase semaphore under Linux!
+                    __LinuxUnlock( &obj->semaphore );
                 #elif defined( __RDOS__ )
                     RdosLeaveSection( obj->semaphore );
                 #elif defined( __RDOSDEV__ )
@@ -457,8 +460,12 @@ struct thread_data *__MultipleThread( void )
         }
         return( tdata );
     #elif defined( __LINUX__ )
-        // TODO: Init multiple threads for Linux!
-        return( NULL );
+        thread_data *tdata;
+        tdata = __LinuxSelf()->tdata;
+        if( tdata == NULL ) {
+            tdata = __LinuxAddThread( tdata );
+        }
+        return( tdata );
     #elif defined( __RDOS__ )
         thread_data *tdata;
         tdata = (thread_data *)__tls_get_value( __TlsIndex );
@@ -562,6 +569,11 @@ void __NTRemoveThread( int close_handle )
         #else
             if( tdata == NULL ) return;
         #endif
+        #if defined( __386__ )
+            if( __ThreadHeapFini != NULL ) {
+                __ThreadHeapFini();
+            }
+        #endif
         thread_handle = tdata->thread_handle;
         __RemoveThreadData( tdata->thread_id );
         #if defined( __RUNTIME_CHECKS__ ) && defined( _M_IX86 )
@@ -657,14 +669,29 @@ void __QNXRemoveThread( void )
 thread_data *__LinuxAddThread( thread_data *tdata )
 /***********************************************/
 {
-    // TODO: Implement this for Linux!
-    return( NULL );
+    tdata = __AllocInitThreadData( tdata );
+    // if tdata is NULL it doesn't matter what we do with it
+    __LinuxSelf()->tdata = tdata;
+    return( tdata );
 }
 
 void __LinuxRemoveThread( void )
 /****************************/
 {
-    // TODO: Implement this for Linux!
+    lnx_thread  *self;
+    thread_data *tdata;
+
+    #if defined( __386__ )
+        if( __ThreadHeapFini != NULL ) {
+            __ThreadHeapFini();
+        }
+    #endif
+    self = __LinuxSelf();
+    tdata = self->tdata;
+    if( tdata != NULL && tdata->__allocated ) {
+        self->tdata = NULL;
+        __FreeInitThreadData( tdata );
+    }
 }
 
 #elif defined( __RDOS__ )
@@ -799,7 +826,9 @@ void __InitMultipleThread( void )
             InitSemaphore.initialized = 1;
             // first thread data already in magic memory
         #elif defined( __LINUX__ )
-            // TODO: Init semaphores for Linux
+            InitSemaphore.semaphore = 0;
+            InitSemaphore.initialized = 1;
+            // first thread data already hangs off the main thread's block
         #elif defined( __RDOS__ )
             InitSemaphore.semaphore = RdosCreateSection();
             InitSemaphore.initialized = 1;
@@ -856,7 +885,7 @@ static void __FiniSema4s( void )              // called from finalizer
     _CloseSemaphore( &FListSemaphore );
     __NTFreeCriticalSection();
     #endif
-    #if !defined( __QNX__ )
+    #if !defined( __QNX__ ) && !defined( __LINUX__ )
     __FiniThreadProcessing();
         #if !defined( __OS2_286__ )
         // All thread data areas freed, including main process thread data
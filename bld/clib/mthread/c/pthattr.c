@@ -0,0 +1,103 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  POSIX thread attribute objects for Linux.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include <stddef.h>
+#include <errno.h>
+#include <pthread.h>
+
+_WCRTLINK int pthread_attr_init( pthread_attr_t *attr )
+/*****************************************************/
+{
+    attr->__detachstate = PTHREAD_CREATE_JOINABLE;
+    attr->__stackaddr = NULL;
+    attr->__stacksize = 0;          // use the default
+    return( 0 );
+}
+
+_WCRTLINK int pthread_attr_destroy( pthread_attr_t *attr )
+/********************************************************/
+{
+    attr = attr;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_attr_setdetachstate( pthread_attr_t *attr, int detachstate )
+/********************************************************************************/
+{
+    if( detachstate != PTHREAD_CREATE_JOINABLE
+      && detachstate != PTHREAD_CREATE_DETACHED ) {
+        return( EINVAL );
+    }
+    attr->__detachstate = detachstate;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_attr_getdetachstate( const pthread_attr_t *attr, int *detachstate )
+/***************************************************************************************/
+{
+    *detachstate = attr->__detachstate;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_attr_setstacksize( pthread_attr_t *attr, size_t stacksize )
+/*******************************************************************************/
+{
+    if( stacksize < PTHREAD_STACK_MIN )
+        return( EINVAL );
+    attr->__stacksize = stacksize;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_attr_getstacksize( const pthread_attr_t *attr, size_t *stacksize )
+/**************************************************************************************/
+{
+    *stacksize = attr->__stacksize;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_attr_setstack( pthread_attr_t *attr, void *stackaddr, size_t stacksize )
+/********************************************************************************************/
+{
+    if( stackaddr == NULL || stacksize < PTHREAD_STACK_MIN )
+        return( EINVAL );
+    attr->__stackaddr = stackaddr;
+    attr->__stacksize = stacksize;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_attr_getstack( const pthread_attr_t *attr, void **stackaddr, size_t *stacksize )
+/****************************************************************************************************/
+{
+    *stackaddr = attr->__stackaddr;
+    *stacksize = attr->__stacksize;
+    return( 0 );
+}
@@ -0,0 +1,153 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  POSIX condition variables for Linux.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include <stddef.h>
+#include <limits.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/time.h>
+#include <pthread.h>
+#include "lnxthrd.h"
+
+/*
+ * Waiters sleep on a sequence number that every signal bumps, so a
+ * signal that lands between a waiter dropping the mutex and reaching
+ * the kernel makes the futex wait return at once instead of being lost.
+ * Wakeups may be spurious, which callers have to allow for anyway.
+ */
+
+static int cond_wait( pthread_cond_t *cond, pthread_mutex_t *mutex,
+                      struct timespec *timeout )
+/**********************************************/
+{
+    int         seq;
+    int         owner;
+    unsigned    count;
+    int         rc;
+
+    if( mutex->__type != PTHREAD_MUTEX_NORMAL ) {
+        if( mutex->__owner != __LinuxSelf()->tid )
+            return( EPERM );
+    }
+    __LinuxXadd( &cond->__waiters, 1 );
+    seq = cond->__seq;
+    // a recursive mutex is released completely, whatever its count
+    owner = mutex->__owner;
+    count = mutex->__count;
+    mutex->__owner = 0;
+    __LinuxUnlock( &mutex->__lock );
+    rc = __LinuxFutexWait( &cond->__seq, seq, timeout );
+    __LinuxXadd( &cond->__waiters, -1 );
+    __LinuxLock( &mutex->__lock );
+    mutex->__owner = owner;
+    mutex->__count = count;
+    return( ( rc == -ETIMEDOUT ) ? ETIMEDOUT : 0 );
+}
+
+_WCRTLINK int pthread_condattr_init( pthread_condattr_t *attr )
+/*************************************************************/
+{
+    attr->__unused = 0;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_condattr_destroy( pthread_condattr_t *attr )
+/****************************************************************/
+{
+    attr = attr;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_cond_init( pthread_cond_t *cond, const pthread_condattr_t *attr )
+/*************************************************************************************/
+{
+    attr = attr;
+    cond->__seq = 0;
+    cond->__waiters = 0;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_cond_destroy( pthread_cond_t *cond )
+/********************************************************/
+{
+    if( cond->__waiters != 0 )
+        return( EBUSY );
+    return( 0 );
+}
+
+_WCRTLINK int pthread_cond_wait( pthread_cond_t *cond, pthread_mutex_t *mutex )
+/*****************************************************************************/
+{
+    return( cond_wait( cond, mutex, NULL ) );
+}
+
+_WCRTLINK int pthread_cond_timedwait( pthread_cond_t *cond, pthread_mutex_t *mutex,
+                                      const struct timespec *abstime )
+/**********************************************************************************/
+{
+    struct timeval  now;
+    struct timespec rel;
+
+    if( abstime->tv_nsec < 0 || abstime->tv_nsec >= 1000000000L )
+        return( EINVAL );
+    // the futex wants a relative timeout
+    gettimeofday( &now, NULL );
+    rel.tv_sec = abstime->tv_sec - now.tv_sec;
+    rel.tv_nsec = abstime->tv_nsec - now.tv_usec * 1000L;
+    if( rel.tv_nsec < 0 ) {
+        rel.tv_nsec += 1000000000L;
+        --rel.tv_sec;
+    }
+    if( rel.tv_sec < 0 )
+        return( ETIMEDOUT );
+    return( cond_wait( cond, mutex, &rel ) );
+}
+
+_WCRTLINK int pthread_cond_signal( pthread_cond_t *cond )
+/*******************************************************/
+{
+    __LinuxXadd( &cond->__seq, 1 );
+    if( cond->__waiters != 0 ) {
+        __LinuxFutexWake( &cond->__seq, 1 );
+    }
+    return( 0 );
+}
+
+_WCRTLINK int pthread_cond_broadcast( pthread_cond_t *cond )
+/**********************************************************/
+{
+    __LinuxXadd( &cond->__seq, 1 );
+    if( cond->__waiters != 0 ) {
+        __LinuxFutexWake( &cond->__seq, INT_MAX );
+    }
+    return( 0 );
+}
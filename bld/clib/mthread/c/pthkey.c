@@ -0,0 +1,145 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  POSIX thread-specific data keys for Linux.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include <stddef.h>
+#include <errno.h>
+#include <pthread.h>
+#include "lnxthrd.h"
+
+/*
+ * Each thread's control block has a value slot per key. Creating or
+ * deleting a key bumps the key's sequence number, and a slot only
+ * holds a value for the key while its own sequence number matches, so
+ * a re-used key starts out NULL in every thread without anybody having
+ * to visit the other threads.
+ */
+
+#define KEY_FREE        0
+#define KEY_USED        1
+
+static volatile int     key_lock;
+static char             key_state[LNX_MAX_KEYS];
+static unsigned         key_seq[LNX_MAX_KEYS];
+static lnx_key_dtor     *key_dtor[LNX_MAX_KEYS];
+
+static void run_dtors( lnx_thread *self )
+/***************************************/
+{
+    lnx_specific    *slot;
+    lnx_key_dtor    *dtor;
+    void            *value;
+    unsigned        key;
+    int             iter;
+    int             again;
+
+    for( iter = 0; iter < PTHREAD_DESTRUCTOR_ITERATIONS; ++iter ) {
+        again = 0;
+        for( key = 0; key < LNX_MAX_KEYS; ++key ) {
+            slot = &self->specific[key];
+            dtor = key_dtor[key];
+            if( dtor == NULL || slot->value == NULL || slot->seq != key_seq[key] )
+                continue;
+            value = slot->value;
+            slot->value = NULL;
+            (*dtor)( value );
+            again = 1;
+        }
+        if( !again ) {
+            break;
+        }
+    }
+}
+
+_WCRTLINK int pthread_key_create( pthread_key_t *key, void (*destructor)( void * ) )
+/**********************************************************************************/
+{
+    unsigned    k;
+
+    __LinuxLock( &key_lock );
+    for( k = 0; k < LNX_MAX_KEYS; ++k ) {
+        if( key_state[k] == KEY_FREE ) {
+            break;
+        }
+    }
+    if( k == LNX_MAX_KEYS ) {
+        __LinuxUnlock( &key_lock );
+        return( EAGAIN );
+    }
+    key_state[k] = KEY_USED;
+    ++key_seq[k];
+    key_dtor[k] = (lnx_key_dtor *)destructor;
+    __LinuxUnlock( &key_lock );
+    if( destructor != NULL ) {
+        __LinuxKeyDtors = run_dtors;
+    }
+    *key = k;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_key_delete( pthread_key_t key )
+/***************************************************/
+{
+    if( key >= LNX_MAX_KEYS || key_state[key] != KEY_USED )
+        return( EINVAL );
+    __LinuxLock( &key_lock );
+    key_dtor[key] = NULL;
+    ++key_seq[key];
+    key_state[key] = KEY_FREE;
+    __LinuxUnlock( &key_lock );
+    return( 0 );
+}
+
+_WCRTLINK int pthread_setspecific( pthread_key_t key, const void *value )
+/***********************************************************************/
+{
+    lnx_specific    *slot;
+
+    if( key >= LNX_MAX_KEYS || key_state[key] != KEY_USED )
+        return( EINVAL );
+    slot = &__LinuxSelf()->specific[key];
+    slot->seq = key_seq[key];
+    slot->value = (void *)value;
+    return( 0 );
+}
+
+_WCRTLINK void *pthread_getspecific( pthread_key_t key )
+/******************************************************/
+{
+    lnx_specific    *slot;
+
+    if( key >= LNX_MAX_KEYS )
+        return( NULL );
+    slot = &__LinuxSelf()->specific[key];
+    if( slot->seq != key_seq[key] )
+        return( NULL );
+    return( slot->value );
+}
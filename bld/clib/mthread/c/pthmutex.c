@@ -0,0 +1,151 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  POSIX mutexes for Linux.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include <stddef.h>
+#include <errno.h>
+#include <pthread.h>
+#include "lnxthrd.h"
+
+/*
+ * The lock word is an ordinary futex lock. Recursive and error-checking
+ * mutexes also record the owner's thread id and a nesting count; normal
+ * ones never look at either, so they cost no more than the lock itself.
+ */
+
+_WCRTLINK int pthread_mutexattr_init( pthread_mutexattr_t *attr )
+/***************************************************************/
+{
+    attr->__type = PTHREAD_MUTEX_DEFAULT;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_mutexattr_destroy( pthread_mutexattr_t *attr )
+/******************************************************************/
+{
+    attr = attr;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_mutexattr_settype( pthread_mutexattr_t *attr, int type )
+/****************************************************************************/
+{
+    if( type != PTHREAD_MUTEX_NORMAL
+      && type != PTHREAD_MUTEX_RECURSIVE
+      && type != PTHREAD_MUTEX_ERRORCHECK ) {
+        return( EINVAL );
+    }
+    attr->__type = type;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_mutexattr_gettype( const pthread_mutexattr_t *attr, int *type )
+/***********************************************************************************/
+{
+    *type = attr->__type;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_mutex_init( pthread_mutex_t *mutex, const pthread_mutexattr_t *attr )
+/*****************************************************************************************/
+{
+    mutex->__lock = 0;
+    mutex->__type = ( attr != NULL ) ? attr->__type : PTHREAD_MUTEX_DEFAULT;
+    mutex->__owner = 0;
+    mutex->__count = 0;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_mutex_destroy( pthread_mutex_t *mutex )
+/***********************************************************/
+{
+    if( mutex->__lock != 0 )
+        return( EBUSY );
+    return( 0 );
+}
+
+_WCRTLINK int pthread_mutex_lock( pthread_mutex_t *mutex )
+/********************************************************/
+{
+    int         self;
+
+    if( mutex->__type == PTHREAD_MUTEX_NORMAL ) {
+        __LinuxLock( &mutex->__lock );
+        return( 0 );
+    }
+    self = __LinuxSelf()->tid;
+    if( mutex->__owner == self ) {
+        if( mutex->__type == PTHREAD_MUTEX_ERRORCHECK )
+            return( EDEADLK );
+        ++mutex->__count;
+        return( 0 );
+    }
+    __LinuxLock( &mutex->__lock );
+    mutex->__owner = self;
+    mutex->__count = 1;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_mutex_trylock( pthread_mutex_t *mutex )
+/***********************************************************/
+{
+    int         self;
+
+    if( mutex->__type == PTHREAD_MUTEX_NORMAL ) {
+        return( __LinuxTryLock( &mutex->__lock ) ? 0 : EBUSY );
+    }
+    self = __LinuxSelf()->tid;
+    if( mutex->__owner == self ) {
+        if( mutex->__type == PTHREAD_MUTEX_ERRORCHECK )
+            return( EBUSY );
+        ++mutex->__count;
+        return( 0 );
+    }
+    if( !__LinuxTryLock( &mutex->__lock ) )
+        return( EBUSY );
+    mutex->__owner = self;
+    mutex->__count = 1;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_mutex_unlock( pthread_mutex_t *mutex )
+/**********************************************************/
+{
+    if( mutex->__type != PTHREAD_MUTEX_NORMAL ) {
+        if( mutex->__owner != __LinuxSelf()->tid )
+            return( EPERM );
+        if( --mutex->__count != 0 )
+            return( 0 );
+        mutex->__owner = 0;
+    }
+    __LinuxUnlock( &mutex->__lock );
+    return( 0 );
+}
@@ -0,0 +1,66 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  POSIX once-only initialisation for Linux.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include <limits.h>
+#include <pthread.h>
+#include "lnxthrd.h"
+
+/* states of a pthread_once_t */
+#define ONCE_NEW        0
+#define ONCE_RUNNING    1
+#define ONCE_DONE       2
+
+typedef void once_fn( void );
+#if defined(_M_IX86)
+    #pragma aux (__outside_CLIB) once_fn;
+#endif
+
+_WCRTLINK int pthread_once( pthread_once_t *once_control, void (*init_routine)( void ) )
+/**************************************************************************************/
+{
+    volatile int    *state;
+
+    state = (volatile int *)once_control;
+    if( *state == ONCE_DONE )
+        return( 0 );
+    if( __LinuxCmpXchg( state, ONCE_NEW, ONCE_RUNNING ) == ONCE_NEW ) {
+        (*(once_fn *)init_routine)();
+        __LinuxXchg( state, ONCE_DONE );
+        __LinuxFutexWake( state, INT_MAX );
+    } else {
+        // somebody else is running it, wait until they are finished
+        while( *state == ONCE_RUNNING ) {
+            __LinuxFutexWait( state, ONCE_RUNNING, NULL );
+        }
+    }
+    return( 0 );
+}
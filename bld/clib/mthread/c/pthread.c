@@ -0,0 +1,172 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  POSIX thread creation, joining and termination for Linux.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include <stddef.h>
+#include <errno.h>
+#include <pthread.h>
+#include "lnxthrd.h"
+#include "mthread.h"
+
+typedef void cleanup_fn( void * );
+#if defined(_M_IX86)
+    #pragma aux (__outside_CLIB) cleanup_fn;
+#endif
+
+_WCRTLINK int pthread_create( pthread_t *thread, const pthread_attr_t *attr,
+                              void *(*start_routine)( void * ), void *arg )
+/***************************************************************************/
+{
+    lnx_thread  *tcb;
+    int         rc;
+
+    __InitMultipleThread();
+    if( attr != NULL ) {
+        rc = __LinuxAllocThread( &tcb, attr->__stackaddr, attr->__stacksize );
+    } else {
+        rc = __LinuxAllocThread( &tcb, NULL, 0 );
+    }
+    if( rc != 0 )
+        return( rc );
+    tcb->start = (lnx_start_fn *)start_routine;
+    tcb->arg = arg;
+    if( attr != NULL && attr->__detachstate == PTHREAD_CREATE_DETACHED ) {
+        tcb->state = LNX_DETACHED;
+    } else {
+        tcb->state = LNX_JOINABLE;
+    }
+    *thread = (pthread_t)tcb;
+    rc = __LinuxStartThread( tcb );
+    if( rc < 0 ) {
+        __LinuxFreeThread( tcb );
+        return( -rc );
+    }
+    return( 0 );
+}
+
+_WCRTLINK int pthread_join( pthread_t thread, void **value_ptr )
+/**************************************************************/
+{
+    lnx_thread  *tcb;
+    int         state;
+    int         tid;
+
+    tcb = (lnx_thread *)thread;
+    if( tcb == __LinuxSelf() )
+        return( EDEADLK );
+    for( ;; ) {
+        state = tcb->state;
+        if( state == LNX_DETACHED || state == LNX_JOINING )
+            return( EINVAL );
+        if( __LinuxCmpXchg( &tcb->state, state, LNX_JOINING ) == state ) {
+            break;
+        }
+    }
+    // the kernel clears tid and wakes us once the thread is truly gone
+    while( (tid = tcb->tid) != 0 ) {
+        __LinuxFutexWait( &tcb->tid, tid, NULL );
+    }
+    if( value_ptr != NULL ) {
+        *value_ptr = tcb->result;
+    }
+    __LinuxFreeThread( tcb );
+    return( 0 );
+}
+
+_WCRTLINK int pthread_detach( pthread_t thread )
+/**********************************************/
+{
+    lnx_thread  *tcb;
+    int         state;
+
+    tcb = (lnx_thread *)thread;
+    for( ;; ) {
+        state = tcb->state;
+        if( state == LNX_DETACHED || state == LNX_JOINING )
+            return( EINVAL );
+        if( __LinuxCmpXchg( &tcb->state, state, LNX_DETACHED ) == state ) {
+            break;
+        }
+    }
+    if( state == LNX_EXITED ) {
+        // nobody is left to release it
+        __LinuxReleaseThread( tcb );
+    }
+    return( 0 );
+}
+
+_WCRTLINK void pthread_exit( void *value_ptr )
+/********************************************/
+{
+    lnx_thread                  *self;
+    struct __pthread_cleanup    *c;
+
+    self = __LinuxSelf();
+    while( (c = self->cleanup) != NULL ) {
+        self->cleanup = c->__prev;
+        (*(cleanup_fn *)c->__routine)( c->__arg );
+    }
+    __LinuxExitThread( value_ptr );
+}
+
+_WCRTLINK pthread_t pthread_self( void )
+/**************************************/
+{
+    return( (pthread_t)__LinuxSelf() );
+}
+
+_WCRTLINK int pthread_equal( pthread_t t1, pthread_t t2 )
+/*******************************************************/
+{
+    return( t1 == t2 );
+}
+
+_WCRTLINK void __pthread_cleanup_push( struct __pthread_cleanup *c,
+                                       void (*routine)( void * ), void *arg )
+/***************************************************************************/
+{
+    lnx_thread  *self;
+
+    self = __LinuxSelf();
+    c->__routine = routine;
+    c->__arg = arg;
+    c->__prev = self->cleanup;
+    self->cleanup = c;
+}
+
+_WCRTLINK void __pthread_cleanup_pop( struct __pthread_cleanup *c, int execute )
+/******************************************************************************/
+{
+    __LinuxSelf()->cleanup = c->__prev;
+    if( execute ) {
+        (*(cleanup_fn *)c->__routine)( c->__arg );
+    }
+}
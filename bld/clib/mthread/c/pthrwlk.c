@@ -0,0 +1,191 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  POSIX read-write locks for Linux.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include <stddef.h>
+#include <limits.h>
+#include <errno.h>
+#include <pthread.h>
+#include "lnxthrd.h"
+
+/*
+ * The counts are kept under a small internal lock. Readers and writers
+ * sleep on separate sequence numbers so that releasing the lock can
+ * wake one writer or all the readers. Writers are preferred: readers
+ * queue up behind a waiting writer, which keeps a steady stream of
+ * readers from starving the writers out.
+ */
+
+_WCRTLINK int pthread_rwlockattr_init( pthread_rwlockattr_t *attr )
+/*****************************************************************/
+{
+    attr->__unused = 0;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_rwlockattr_destroy( pthread_rwlockattr_t *attr )
+/********************************************************************/
+{
+    attr = attr;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_rwlock_init( pthread_rwlock_t *rwlock, const pthread_rwlockattr_t *attr )
+/*********************************************************************************************/
+{
+    attr = attr;
+    rwlock->__lock = 0;
+    rwlock->__readers = 0;
+    rwlock->__writer = 0;
+    rwlock->__rwait = 0;
+    rwlock->__wwait = 0;
+    rwlock->__rseq = 0;
+    rwlock->__wseq = 0;
+    return( 0 );
+}
+
+_WCRTLINK int pthread_rwlock_destroy( pthread_rwlock_t *rwlock )
+/**************************************************************/
+{
+    if( rwlock->__readers != 0 || rwlock->__writer != 0 )
+        return( EBUSY );
+    return( 0 );
+}
+
+_WCRTLINK int pthread_rwlock_rdlock( pthread_rwlock_t *rwlock )
+/*************************************************************/
+{
+    int         seq;
+
+    __LinuxLock( &rwlock->__lock );
+    while( rwlock->__writer != 0 || rwlock->__wwait != 0 ) {
+        if( rwlock->__writer == __LinuxSelf()->tid ) {
+            __LinuxUnlock( &rwlock->__lock );
+            return( EDEADLK );
+        }
+        ++rwlock->__rwait;
+        seq = rwlock->__rseq;
+        __LinuxUnlock( &rwlock->__lock );
+        __LinuxFutexWait( &rwlock->__rseq, seq, NULL );
+        __LinuxLock( &rwlock->__lock );
+        --rwlock->__rwait;
+    }
+    ++rwlock->__readers;
+    __LinuxUnlock( &rwlock->__lock );
+    return( 0 );
+}
+
+_WCRTLINK int pthread_rwlock_tryrdlock( pthread_rwlock_t *rwlock )
+/****************************************************************/
+{
+    int         rc;
+
+    __LinuxLock( &rwlock->__lock );
+    if( rwlock->__writer != 0 || rwlock->__wwait != 0 ) {
+        rc = EBUSY;
+    } else {
+        ++rwlock->__readers;
+        rc = 0;
+    }
+    __LinuxUnlock( &rwlock->__lock );
+    return( rc );
+}
+
+_WCRTLINK int pthread_rwlock_wrlock( pthread_rwlock_t *rwlock )
+/*************************************************************/
+{
+    int         self;
+    int         seq;
+
+    self = __LinuxSelf()->tid;
+    __LinuxLock( &rwlock->__lock );
+    while( rwlock->__writer != 0 || rwlock->__readers != 0 ) {
+        if( rwlock->__writer == self ) {
+            __LinuxUnlock( &rwlock->__lock );
+            return( EDEADLK );
+        }
+        ++rwlock->__wwait;
+        seq = rwlock->__wseq;
+        __LinuxUnlock( &rwlock->__lock );
+        __LinuxFutexWait( &rwlock->__wseq, seq, NULL );
+        __LinuxLock( &rwlock->__lock );
+        --rwlock->__wwait;
+    }
+    rwlock->__writer = self;
+    __LinuxUnlock( &rwlock->__lock );
+    return( 0 );
+}
+
+_WCRTLINK int pthread_rwlock_trywrlock( pthread_rwlock_t *rwlock )
+/****************************************************************/
+{
+    int         rc;
+
+    __LinuxLock( &rwlock->__lock );
+    if( rwlock->__writer != 0 || rwlock->__readers != 0 ) {
+        rc = EBUSY;
+    } else {
+        rwlock->__writer = __LinuxSelf()->tid;
+        rc = 0;
+    }
+    __LinuxUnlock( &rwlock->__lock );
+    return( rc );
+}
+
+_WCRTLINK int pthread_rwlock_unlock( pthread_rwlock_t *rwlock )
+/*************************************************************/
+{
+    __LinuxLock( &rwlock->__lock );
+    if( rwlock->__writer != 0 ) {
+        if( rwlock->__writer != __LinuxSelf()->tid ) {
+            __LinuxUnlock( &rwlock->__lock );
+            return( EPERM );
+        }
+        rwlock->__writer = 0;
+    } else if( rwlock->__readers > 0 ) {
+        --rwlock->__readers;
+    } else {
+        __LinuxUnlock( &rwlock->__lock );
+        return( EPERM );
+    }
+    if( rwlock->__readers == 0 && rwlock->__wwait != 0 ) {
+        ++rwlock->__wseq;
+        __LinuxUnlock( &rwlock->__lock );
+        __LinuxFutexWake( &rwlock->__wseq, 1 );
+    } else if( rwlock->__wwait == 0 && rwlock->__rwait != 0 ) {
+        ++rwlock->__rseq;
+        __LinuxUnlock( &rwlock->__lock );
+        __LinuxFutexWake( &rwlock->__rseq, INT_MAX );
+    } else {
+        __LinuxUnlock( &rwlock->__lock );
+    }
+    return( 0 );
+}
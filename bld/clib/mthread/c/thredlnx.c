@@ -36,6 +36,7 @@
 #include <unistd.h>
 #include <errno.h>
 #include <process.h>
+#include <sys/mman.h>
 
 #include "liballoc.h"
 #include "osthread.h"
@@ -46,28 +47,238 @@
 #include "seterrno.h"
 #include "cthread.h"
 #include "linuxsys.h"
+#include "lnxthrd.h"
+
+#if defined( __386__ )
+
+/*
+ * A thread's stack, control block and thread data normally share one
+ * mapping: a guard page, then the stack, with the control block and
+ * thread data at the top. The kernel clears the control block's tid
+ * once the thread has gone for good (CLONE_CHILD_CLEARTID), and only
+ * then may the mapping be released; pthread_join() waits for that, and
+ * detached threads leave themselves on a list that later thread
+ * creations sweep.
+ */
+
+#define THREAD_FLAGS    (CLONE_VM | CLONE_FS | CLONE_FILES | CLONE_SIGHAND \
+                        | CLONE_THREAD | CLONE_SYSVSEM | CLONE_SETTLS \
+                        | CLONE_PARENT_SETTID | CLONE_CHILD_CLEARTID)
+
+void                (*__LinuxKeyDtors)( lnx_thread * );
+
+static lnx_thread   *dead_list;
+static volatile int dead_lock;
+
+static void thread_start( lnx_thread *self );
+#pragma aux thread_start parm [eax] aborts;
+
+/*
+ * The child comes back from clone() on its own stack, which holds the
+ * address of thread_start() and the control block to pass it.
+ */
+extern int sys_clone( unsigned flags, void *stack, volatile int *ptid,
+                      lnx_tls_desc *tls, volatile int *ctid );
+#pragma aux sys_clone =                 \
+        "mov    eax,120"                /* SYS_clone */ \
+        "int    0x80"                   \
+        "test   eax,eax"                \
+        "jnz    c_parent"               \
+        "xor    ebp,ebp"                \
+        "pop    ecx"                    \
+        "pop    eax"                    \
+        "call   ecx"                    \
+"c_parent:"                             \
+        parm [ebx] [ecx] [edx] [esi] [edi] \
+        value [eax]                     \
+        modify exact [eax];
+
+static void reap_dead( void )
+/***************************/
+{
+    lnx_thread  **owner;
+    lnx_thread  *tcb;
+
+    if( dead_list == NULL )
+        return;
+    __LinuxLock( &dead_lock );
+    for( owner = &dead_list; (tcb = *owner) != NULL; ) {
+        if( tcb->tid == 0 ) {
+            *owner = tcb->next;
+            munmap( tcb->map, tcb->map_size );
+        } else {
+            owner = &tcb->next;
+        }
+    }
+    __LinuxUnlock( &dead_lock );
+}
+
+int __LinuxAllocThread( lnx_thread **ptcb, void *stack_bottom,
+                        unsigned stack_size )
+/************************************************************/
+{
+    lnx_thread  *tcb;
+    char        *map;
+    unsigned    map_size;
+    unsigned    block;
+
+    reap_dead();
+    block = (sizeof( lnx_thread ) + __ThreadDataSize + 15) & ~15;
+    if( stack_bottom != NULL ) {
+        // carve the control block out of the top of the caller's stack
+        if( stack_size < block + 4096 )
+            return( EINVAL );
+        map = NULL;
+        map_size = 0;
+        tcb = (lnx_thread *)(((unsigned)stack_bottom + stack_size - block) & ~15);
+    } else {
+        if( stack_size == 0 ) {
+            stack_size = LNX_STACK_SIZE;
+        }
+        map_size = __Align4K( LNX_GUARD_SIZE + stack_size + block );
+        map = mmap( NULL, map_size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if( map == MAP_FAILED )
+            return( EAGAIN );
+        mprotect( map, LNX_GUARD_SIZE, PROT_NONE );
+        stack_bottom = map + LNX_GUARD_SIZE;
+        tcb = (lnx_thread *)(map + map_size - block);
+    }
+    memset( tcb, 0, block );
+    tcb->self = tcb;
+    tcb->tdata = (thread_data *)(tcb + 1);
+    tcb->tdata->__data_size = __ThreadDataSize;
+    tcb->stack_low = stack_bottom;
+    tcb->map = map;
+    tcb->map_size = map_size;
+    *ptcb = tcb;
+    return( 0 );
+}
+
+void __LinuxFreeThread( lnx_thread *tcb )
+/***************************************/
+{
+    if( tcb->map != NULL ) {
+        munmap( tcb->map, tcb->map_size );
+    }
+}
+
+void __LinuxReleaseThread( lnx_thread *tcb )
+/******************************************/
+{
+    if( tcb->map != NULL ) {
+        __LinuxLock( &dead_lock );
+        tcb->next = dead_list;
+        dead_list = tcb;
+        __LinuxUnlock( &dead_lock );
+    }
+}
+
+int __LinuxStartThread( lnx_thread *tcb )
+/***************************************/
+{
+    lnx_tls_desc    desc;
+    unsigned        *sp;
+
+    desc.entry = __LinuxTLSEntry;
+    desc.base = tcb;
+    desc.limit = 0xfffff;
+    desc.flags = LNX_TLS_FLAGS;
+    sp = (unsigned *)tcb;
+    *--sp = (unsigned)tcb;
+    *--sp = (unsigned)&thread_start;
+    // returns the new thread's id, or a negated error number
+    return( sys_clone( THREAD_FLAGS, sp, &tcb->tid, &desc, &tcb->tid ) );
+}
+
+static void thread_start( lnx_thread *self )
+/******************************************/
+{
+    void        *result;
+
+    __LinuxAddThread( self->tdata );
+    _STACKLOW = (unsigned)self->stack_low;
+    _fpreset();
+    if( self->begin != NULL ) {
+        (*self->begin)( self->arg );
+        result = NULL;
+    } else {
+        result = (*self->start)( self->arg );
+    }
+    __LinuxExitThread( result );
+}
+
+void __LinuxExitThread( void *result )
+/************************************/
+{
+    lnx_thread  *self;
+
+    self = __LinuxSelf();
+    self->result = result;
+    if( __LinuxKeyDtors != NULL ) {
+        __LinuxKeyDtors( self );
+    }
+    __LinuxRemoveThread();
+    if( __LinuxCmpXchg( &self->state, LNX_JOINABLE, LNX_EXITED ) == LNX_DETACHED ) {
+        __LinuxReleaseThread( self );
+    }
+    // SYS_exit ends just this thread, the others carry on
+    for( ;; ) {
+        sys_call1( SYS_exit, 0 );
+    }
+}
 
 int __CBeginThread( thread_fn *start_addr, void *stack_bottom,
                     unsigned stack_size, void *arglist )
 /******************************************************/
 {
-	pid_t pid;
-
-	if( start_addr == NULL || stack_bottom == NULL || stack_size == 0 ) {
-		return( -1L );
-	}
-    pid = clone( CLONE_VM | CLONE_FS | CLONE_FILES | CLONE_SIGHAND | SIGCHLD, (void*)((int)stack_bottom + stack_size) );
-	if( pid ) {
-	    return( (int)pid );
-	} else {
-		start_addr(arglist);
-		_endthread();
-		return 0;
-	}
+    lnx_thread  *tcb;
+    int         rc;
+
+    if( start_addr == NULL ) {
+        __set_errno( EINVAL );
+        return( -1 );
+    }
+    __InitMultipleThread();
+    rc = __LinuxAllocThread( &tcb, stack_bottom, stack_size );
+    if( rc == 0 ) {
+        tcb->begin = start_addr;
+        tcb->arg = arglist;
+        tcb->state = LNX_DETACHED;
+        rc = __LinuxStartThread( tcb );
+        if( rc > 0 ) {
+            // the thread may already be gone, so tcb->tid is off limits
+            return( rc );
+        }
+        __LinuxFreeThread( tcb );
+        rc = -rc;
+    }
+    __set_errno( rc );
+    return( -1 );
 }
 
 void __CEndThread( void )
 /***********************/
 {
-	sys_exit(0);
+    __LinuxExitThread( NULL );
 }
+
+#else
+
+int __CBeginThread( thread_fn *start_addr, void *stack_bottom,
+                    unsigned stack_size, void *arglist )
+/******************************************************/
+{
+    start_addr = start_addr; stack_bottom = stack_bottom;
+    stack_size = stack_size; arglist = arglist;
+    __set_errno( ENOSYS );
+    return( -1 );
+}
+
+void __CEndThread( void )
+/***********************/
+{
+    sys_exit( 0 );
+}
+
+#endif
@@ -76,15 +76,18 @@ static char *med3( char *a, char *b, char *c, qcomp cmp )
     #define PTRATTR
     #define MED3                med3
     #define BYTESWAP            aligned_byteswap
+    #define WORDSWAP            aligned_wordswap
     #include "qsortrtn.c"
 
     #undef FUNCTION_NAME
     #undef PTRATTR
     #undef MED3
     #undef BYTESWAP
+    #undef WORDSWAP
     #define FUNCTION_NAME       unaligned_qsort
     #define PTRATTR             __unaligned
     #define BYTESWAP            unaligned_byteswap
+    #define WORDSWAP            unaligned_wordswap
     #define MED3(a,b,c,f)       med3( (char*)(a), (char*)(b), (char*)(c), (f) )
     #include "qsortrtn.c"
 
@@ -111,6 +114,7 @@ static char *med3( char *a, char *b, char *c, qcomp cmp )
     #define PTRATTR
     #define MED3                med3
     #define BYTESWAP            byteswap
+    #define WORDSWAP            wordswap
     #include "qsortrtn.c"
 
 #endif
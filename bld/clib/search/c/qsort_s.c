@@ -76,15 +76,18 @@ static char *med3( char *a, char *b, char *c, qcomp cmp, void *context )
     #define PTRATTR
     #define MED3                med3
     #define BYTESWAP            aligned_byteswap
+    #define WORDSWAP            aligned_wordswap
     #include "qsortr_s.c"
 
     #undef FUNCTION_NAME
     #undef PTRATTR
     #undef MED3
     #undef BYTESWAP
+    #undef WORDSWAP
     #define FUNCTION_NAME       unaligned_qsort
     #define PTRATTR             __unaligned
     #define BYTESWAP            unaligned_byteswap
+    #define WORDSWAP            unaligned_wordswap
     #define MED3(a,b,c,f,x)     med3( (char*)(a), (char*)(b), (char*)(c), (f), (x) )
     #include "qsortr_s.c"
 
@@ -113,6 +116,7 @@ static char *med3( char *a, char *b, char *c, qcomp cmp, void *context )
     #define PTRATTR
     #define MED3                med3
     #define BYTESWAP            byteswap
+    #define WORDSWAP            wordswap
     #include "qsortr_s.c"
 
 #endif
@@ -38,63 +38,32 @@
 /* Support OS/2 16-bit protected mode - will never get stack overflow */
 #define MAXDEPTH        (sizeof(long) * 8)
 
-#define SHELL           3       /* Shell constant used in shell sort */
+#define INSERTION       16      /* Partitions smaller than this are insertion sorted */
 
 typedef int WORD;
 #define W sizeof( WORD )
 
 /*
-    swap() is a macro that chooses between an in_line function call and
-    an exchange macro.
+    swap() is a macro that chooses between an exchange macro for single
+    words, a word at a time loop for larger aligned elements and the
+    general byte swapping routine.
 */
 #define exch( a, b, t)          ( t = a, a = b, b = t )
 #define swap( a, b )    \
-    swaptype != 0 ? BYTESWAP( a, b, size ) : \
-    ( void ) exch( *( WORD* )( a ), *( WORD* )( b ), t )
+    swaptype == 0 ? ( void ) exch( *( WORD* )( a ), *( WORD* )( b ), t ) : \
+    swaptype == 1 ? WORDSWAP( ( PTRATTR WORD* )( a ), ( PTRATTR WORD* )( b ), size / W ) : \
+    BYTESWAP( a, b, size )
 
 /*
     Note:   The following assembly was timed against several other methods
     of doing the same thing.  The pragmas here were either fastest on all
     machines tested, or fastest on most machines tested. (including an 8088,
-    386 16mhz, 386 33mhz, and 486 25mhz).
+    386 16mhz, 386 33mhz, and 486 25mhz). The 386 version has been dropped:
+    xchg with a memory operand is implicitly locked, which makes it far
+    slower than plain moves on anything since the Pentium Pro.
 */
 
-#if defined( __386__ )
-    /* this is intended for 386 only... */
-    void inline_swap( char *p, char *q, size_t size );
-    #pragma aux inline_swap = \
-        0x06                            /*      push es             */ \
-        0x1e                            /*      push ds             */ \
-        0x07                            /*      pop  es             */ \
-        0x0f 0xb6 0xd1                  /*      movzx   edx,cl      */ \
-        0xc1 0xe9 0x02                  /*      shr     ecx,02H     */ \
-        0x74 0x0b                       /*      je      L1          */ \
-        0x8b 0x07                       /*L2    mov     eax,[edi]   */ \
-        0x87 0x06                       /*      xchg    eax,[esi]   */ \
-        0xab                            /*      stosd               */ \
-        0x83 0xc6 0x04                  /*      add     esi,0004H   */ \
-        0x49                            /*      dec     ecx         */ \
-        0x75 0xf5                       /*      jne     L2          */ \
-        0x80 0xe2 0x03                  /*L1    and     dl,03H      */ \
-        0x74 0x09                       /*      je      L3          */ \
-        0x8a 0x07                       /*L4    mov     al,[edi]    */ \
-        0x86 0x06                       /*      xchg    al,[esi]    */ \
-        0xaa                            /*      stosb               */ \
-        0x46                            /*      inc     esi         */ \
-        0x4a                            /*      dec     edx         */ \
-        0x75 0xf7                       /*      jne     L4          */ \
-                                        /*L3                        */ \
-        0x07                            /*      pop  es             */ \
-        parm caller [esi] [edi] [ecx] \
-        value \
-        modify exact [esi edi ecx eax edx];
-    #pragma aux byteswap parm [esi] [edi] [ecx] \
-        modify exact [esi edi ecx eax edx];
-    static void _WCNEAR byteswap( char *p, char *q, size_t size ) {
-        inline_swap( p, q, size );
-    }
-
-#elif defined( _M_I86 ) && defined( __BIG_DATA__ )
+#if defined( _M_I86 ) && defined( __BIG_DATA__ )
     void inline_swap( char _WCFAR *p, char _WCFAR *q, size_t size );
     #pragma aux inline_swap = \
         0x1e                            /*      push ds             */ \
@@ -191,6 +160,18 @@ typedef int WORD;
 #endif
 
 
+/* Swap two elements whose size is a multiple of the word size */
+static void _WCNEAR WORDSWAP( PTRATTR WORD *p, PTRATTR WORD *q, size_t count ) {
+    WORD    word;
+
+    do {
+        word = *p;
+        *p++ = *q;
+        *q++ = word;
+    } while( --count );
+}
+
+
 FUNCTION_LINKAGE void FUNCTION_NAME(
                                      PTRATTR void *in_base, size_t n,
                                      size_t size,
@@ -210,11 +191,14 @@ FUNCTION_LINKAGE void FUNCTION_NAME(
     PTRATTR char *      mid;
     WORD                v;              /* used in pivot initialization */
     WORD                t;              /* used in exch() macro */
-    int                 comparison, swaptype, shell;
+    int                 comparison, swaptype;
     size_t              count, r, s;
+    size_t              i, child;       /* used by the heapsort fallback */
     unsigned int        sp;
+    unsigned int        depth;
     auto char *         base_stack[MAXDEPTH];
     auto unsigned int   n_stack[MAXDEPTH];
+    auto unsigned char  depth_stack[MAXDEPTH];
     qcomp *             cmp = (qcomp*) compar;
 
     /*
@@ -224,24 +208,59 @@ FUNCTION_LINKAGE void FUNCTION_NAME(
         2 for swapping by bytes.  W (it's a macro) = sizeof(WORD).
     */
     swaptype = ( ( base - (char *)0 ) | size ) % W ? 2 : size > W ? 1 : 0;
+    /*
+        depth bounds the number of partitioning passes on the way down to
+        any one piece. Pivot selection guards against the common bad
+        cases, but an adversarial input can still defeat it; once the
+        budget is used up the piece is heapsorted instead, which keeps the
+        worst case at O(n log n).
+    */
+    depth = 0;
+    for( count = n; count > 1; count >>= 1 ) {
+        depth += 2;
+    }
     sp = 0;
     for(;;) {
         while( n > 1 ) {
-            if( n < 16 ) {      /* 2-shell sort on smallest arrays */
-                for( shell = (size * SHELL) ;
-                     shell > 0 ;
-                     shell -= ((SHELL-1) * size) ) {
-                    p1 = base + shell;
-                    for( ; p1 < base + n * size; p1 += shell ) {
-                        for( p2 = p1;
-                             p2 > base && cmp( p2 - shell, p2 ) > 0;
-                             p2 -= shell ) {
-                            swap( p2, p2 - shell );
+            if( n < INSERTION ) {   /* insertion sort on smallest arrays */
+                pn = base + n * size;
+                for( p1 = base + size; p1 < pn; p1 += size ) {
+                    for( p2 = p1;
+                         p2 > base && cmp( p2 - size, p2 ) > 0;
+                         p2 -= size ) {
+                        swap( p2, p2 - size );
+                    }
+                }
+                break;
+            } else if( depth == 0 ) {   /* too many bad pivots, heapsort */
+                /*
+                    The first n/2 passes build the heap by sifting down
+                    each interior node; after that each pass moves the
+                    largest element to the end and sifts down the root.
+                */
+                r = n >> 1;
+                count = n;
+                for(;;) {
+                    if( r > 0 ) {
+                        --r;
+                    } else {
+                        if( --count == 0 ) break;
+                        swap( base, base + count * size );
+                    }
+                    for( i = r; (child = 2 * i + 1) < count; i = child ) {
+                        p1 = base + child * size;
+                        if( child + 1 < count && cmp( p1, p1 + size ) < 0 ) {
+                            ++child;
+                            p1 += size;
                         }
+                        p2 = base + i * size;
+                        if( cmp( p2, p1 ) >= 0 ) break;
+                        swap( p2, p1 );
                     }
                 }
                 break;
-            } else {    /* n >= 16 */
+            } else {    /* n >= INSERTION */
+                --depth;
                 /* Small array (15 < n < 30), mid element */
                 mid = base + (n >> 1) * size;
                 if( n > 29 ) {
@@ -326,6 +345,7 @@ FUNCTION_LINKAGE void FUNCTION_NAME(
                 /* The middle 'chunk' contains all elements=pivot value*/
                 r = pb - pa;
                 s = pd - pc;
+                depth_stack[sp] = depth;
                 if( s >= r ) {  /* Stack up the larger chunk */
                     base_stack[sp] = pn - s;/* Stack up base       */
                     n_stack[sp] = s / size;     /* Stack up n              */
@@ -343,7 +363,8 @@ FUNCTION_LINKAGE void FUNCTION_NAME(
         }
         if( sp == 0 ) break;
         --sp;
-        base = base_stack[sp];
-        n    = n_stack[sp];
+        base  = base_stack[sp];
+        n     = n_stack[sp];
+        depth = depth_stack[sp];
     }
 }
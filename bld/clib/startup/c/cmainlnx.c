@@ -42,10 +42,11 @@ int     _argc;                      /* argument count  */
 char    **_argv;                    /* argument vector */
 
 extern int main( int, char **, char ** );
+extern void __LinuxInit( void * );
 
 void __cdecl _LinuxMain( int argc, char **argv, char **arge )
 {
-//    thread_data *tdata;
+    thread_data *tdata;
 
     // Initialise the heap. To do this we call sbrk() with
     // a value of 0, which will return the current top of the
@@ -62,9 +63,11 @@ void __cdecl _LinuxMain( int argc, char **argv, char **arge )
     _LpPgmName          = argv[0];
 
     __InitRtns( INIT_PRIORITY_THREAD );
-//    tdata = __alloca( __ThreadDataSize );
-//    memset( tdata, 0, __ThreadDataSize );
-//    tdata->__data_size = __ThreadDataSize;
+    tdata = __alloca( __ThreadDataSize );
+    memset( tdata, 0, __ThreadDataSize );
+    // tdata->__allocated = 0;
+    tdata->__data_size = __ThreadDataSize;
+    __LinuxInit( tdata );
     __InitRtns( 255 );
 
     /* allocate alternate stack for F77 */
@@ -0,0 +1,125 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Detect processor features used to pick faster code paths.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#if defined( __NT__ )
+  #include <windows.h>
+#endif
+#include "rtinit.h"
+#include "cpufeat.h"
+
+#ifndef PF_XMMI_INSTRUCTIONS_AVAILABLE
+  #define PF_XMMI_INSTRUCTIONS_AVAILABLE    6
+#endif
+#ifndef PF_XMMI64_INSTRUCTIONS_AVAILABLE
+  #define PF_XMMI64_INSTRUCTIONS_AVAILABLE  10
+#endif
+
+#define EDX_MMX         0x00800000UL
+#define EDX_SSE         0x02000000UL
+#define EDX_SSE2        0x04000000UL
+
+unsigned __cpu_features;
+
+/* CPUID leaf 1 feature flags (EDX); 0 if the ID bit in EFLAGS is fixed */
+extern unsigned long __cpuid_edx( void );
+#pragma aux __cpuid_edx =           \
+        ".586"                      \
+        "pushfd"                    \
+        "pop    eax"                \
+        "mov    ecx,eax"            \
+        "xor    eax,200000h"        /* try to flip the ID bit */ \
+        "push   eax"                \
+        "popfd"                     \
+        "pushfd"                    \
+        "pop    eax"                \
+        "push   ecx"                /* restore original flags */ \
+        "popfd"                     \
+        "xor    edx,edx"            \
+        "xor    eax,ecx"            \
+        "test   eax,200000h"        \
+        "jz     nocpuid"            \
+        "mov    eax,1"              \
+        "cpuid"                     \
+"nocpuid:"                          \
+        value [edx]                 \
+        modify exact [eax ebx ecx edx];
+
+#if defined( __NT__ )
+typedef BOOL (WINAPI *feature_fn)( DWORD );
+
+/*
+ * Only trust the SSE bits if the OS says it saves XMM state on a task
+ * switch. IsProcessorFeaturePresent is missing on Windows 95, so look it
+ * up rather than importing it.
+ */
+static int os_has_feature( DWORD feature )
+{
+    HMODULE     kernel;
+    feature_fn  fn;
+
+    kernel = GetModuleHandle( "KERNEL32" );
+    if( kernel == NULL )
+        return( 0 );
+    fn = (feature_fn)GetProcAddress( kernel, "IsProcessorFeaturePresent" );
+    if( fn == NULL )
+        return( 0 );
+    return( fn( feature ) != 0 );
+}
+#endif
+
+static void __init_cpu_features( void )
+{
+    unsigned long   edx;
+    unsigned        features;
+
+    edx = __cpuid_edx();
+    if( edx == 0 )
+        return;
+    features = CPU_CPUID;
+    if( edx & EDX_MMX )
+        features |= CPU_MMX;
+#if defined( __NT__ )
+    if( (edx & EDX_SSE) && os_has_feature( PF_XMMI_INSTRUCTIONS_AVAILABLE ) )
+        features |= CPU_SSE;
+    if( (edx & EDX_SSE2) && os_has_feature( PF_XMMI64_INSTRUCTIONS_AVAILABLE ) )
+        features |= CPU_SSE2;
+#elif defined( __LINUX__ )
+    /* every kernel we support saves XMM state */
+    if( edx & EDX_SSE )
+        features |= CPU_SSE;
+    if( edx & EDX_SSE2 )
+        features |= CPU_SSE2;
+#endif
+    __cpu_features = features;
+}
+
+AXI( __init_cpu_features, INIT_PRIORITY_RUNTIME )
@@ -40,6 +40,7 @@ struct thread_data *__FirstThreadData = (struct thread_data *)&_STACKLOW;
 #include "rtdata.h"
 #include "initfini.h"
 #include "linuxsys.h"
+#include "lnxthrd.h"
 
 extern void __InitThreadData( thread_data * );
 
@@ -75,6 +76,7 @@ void __LinuxInit( void *ptr )
 {
     unsigned    *tmp;
 
+    __LinuxInitMainThread( ptr );
     __InitThreadData( ptr );
     __FirstThreadData = ptr;
 
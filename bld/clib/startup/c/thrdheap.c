@@ -0,0 +1,57 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Link this object to give each thread its own cache of
+*               small heap blocks.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include "rtinit.h"
+#include "thrdheap.h"
+
+/*
+ * Built the same way as commode.obj; see the notes there. The caches
+ * are turned on as the library initializes, so blocks allocated before
+ * this simply go back through the cache when they are freed.
+ *
+ * A thread's cache is handed back to the heap when the thread ends
+ * through _endthread()/_endthreadex() (or by returning from a thread
+ * started with _beginthread()/_beginthreadex()), or, in a DLL, on
+ * DLL_THREAD_DETACH. A thread an executable starts with CreateThread()
+ * and that ends with ExitThread() or by returning goes by neither, so
+ * the blocks in its cache, at most CACHE_MAX of each size (see
+ * tcache.c), stay allocated until the program ends.
+ */
+
+static void do_it( void )
+{
+    __set_thread_heap();
+}
+
+
+AXI( do_it, INIT_PRIORITY_LIBRARY )
@@ -107,30 +107,28 @@ static int __filbuf( FILE *fp )
     }
 }
 
-_WCRTLINK int fgetc( FILE *fp )
+_WCRTLINK int fgetc_unlocked( FILE *fp )
 {
     int c;
 
     _ValidFile( fp, EOF );
-    _AccessFile( fp );
 
     /*** Deal with stream orientation ***/
-    ORIENT_STREAM(fp,EOF);
+    ORIENT_STREAM_UNLOCKED(fp,EOF);
 
     if( (fp->_flag & _READ) == 0 ) {
         __set_errno( EBADF );
         fp->_flag |= _SFERR;
-        c = EOF;
+        return( EOF );
+    }
+    fp->_cnt--;
+    // it is important that this remain a relative comparison
+    // to ensure that the getc() macro works properly
+    if( fp->_cnt < 0 ) {
+        c = __filbuf( fp );
     } else {
-        fp->_cnt--;
-        // it is important that this remain a relative comparison
-        // to ensure that the getc() macro works properly
-        if( fp->_cnt < 0 ) {
-            c = __filbuf( fp );
-        } else {
-            c = *fp->_ptr;
-            fp->_ptr++;
-        }
+        c = *fp->_ptr;
+        fp->_ptr++;
     }
 #ifndef __UNIX__
     if( !(fp->_flag & _BINARY) ) {
@@ -151,6 +149,16 @@ _WCRTLINK int fgetc( FILE *fp )
         }
     }
 #endif
+    return( c );
+}
+
+_WCRTLINK int fgetc( FILE *fp )
+{
+    int c;
+
+    _ValidFile( fp, EOF );
+    _AccessFile( fp );
+    c = fgetc_unlocked( fp );
     _ReleaseFile( fp );
     return( c );
 }
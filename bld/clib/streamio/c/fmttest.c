@@ -179,6 +179,16 @@ int Test_string_to_float( void )
     x = strtod( "-1.0e99999", NULL );
     VERIFY( isinf( x ) && signbit( x ) );
 
+    /* Correct rounding, with halfway cases going to even */
+    x = strtod( "9007199254740993", NULL );
+    VERIFY( x == 9007199254740992.0 );
+
+    x = strtod( "9007199254740995", NULL );
+    VERIFY( x == 9007199254740996.0 );
+
+    x = strtod( "0.1000000000000000055511151231257827", NULL );
+    VERIFY( x == strtod( "0.1", NULL ) );
+
     return( 1 );
 }
 
@@ -221,6 +231,7 @@ int Test_print_float( void )
     long double lval;
     double      dval;
     float       fval;
+    int         i;
 
     VERIFY( sprintf( buf, "%+#22.14e", 123456789.0 ) == 22 );
     VERIFY( !strcmp( buf, " +1.23456789000000e+08" ) );
@@ -268,6 +279,28 @@ int Test_print_float( void )
     VERIFY( sprintf( buf, "%0.9e", 99999999999.99 ) == 15 );
     VERIFY( !strcmp( buf, "1.000000000e+11" ) );
 
+    VERIFY( sprintf( buf, "%.2f", 1.005 ) == 4 );
+    VERIFY( !strcmp( buf, "1.00" ) );
+
+    VERIFY( sprintf( buf, "%.3e", 2.5e-5 ) == 9 );
+    VERIFY( !strcmp( buf, "2.500e-05" ) );
+
+    VERIFY( sprintf( buf, "%g", 1e23 ) == 5 );
+    VERIFY( !strcmp( buf, "1e+23" ) );
+
+    VERIFY( sprintf( buf, "%.15g", 0.1 ) == 3 );
+    VERIFY( !strcmp( buf, "0.1" ) );
+
+    VERIFY( sprintf( buf, "%.17g", 0.1 ) == 19 );
+    VERIFY( !strcmp( buf, "0.10000000000000001" ) );
+
+    /* Seventeen digits are enough for any double to read back */
+    for( dval = 1.0 / 3.0, i = 0; i < 100; ++i ) {
+        VERIFY( sprintf( buf, "%.17g", dval ) > 0 );
+        VERIFY( strtod( buf, NULL ) == dval );
+        dval *= -7.1;
+    }
+
 #if defined( _NAN ) && defined( _INF )
     /* Test NaN/inf formatting */
     VERIFY( sprintf( buf, "%e", _INF ) == 3 );
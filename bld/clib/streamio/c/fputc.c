@@ -47,20 +47,18 @@
 
 #ifndef __WIDECHAR__
 
-_WCRTLINK int fputc( int c, FILE *fp )
+_WCRTLINK int fputc_unlocked( int c, FILE *fp )
 {
     int flags;
 
     _ValidFile( fp, EOF );
-    _AccessFile( fp );
 
     /*** Deal with stream orientation ***/
-    ORIENT_STREAM(fp,EOF);
+    ORIENT_STREAM_UNLOCKED(fp,EOF);
 
     if( !(fp->_flag & _WRITE) ) {
         __set_errno( EBADF );
         fp->_flag |= _SFERR;
-        _ReleaseFile( fp );
         return( EOF );
     }
     if( _FP_BASE(fp) == NULL ) {
@@ -77,7 +75,6 @@ _WCRTLINK int fputc( int c, FILE *fp )
             fp->_cnt++;
             if( fp->_cnt == fp->_bufsize ) {
                 if( __flush( fp ) ) {
-                    _ReleaseFile( fp );
                     return( EOF );
                 }
             }
@@ -90,14 +87,21 @@ _WCRTLINK int fputc( int c, FILE *fp )
     fp->_cnt++;
     if( (fp->_flag & flags) || (fp->_cnt == fp->_bufsize) ) {
         if( __flush( fp ) ) {
-            _ReleaseFile( fp );
             return( EOF );
         }
     }
-    _ReleaseFile( fp );
     return( (UCHAR_TYPE)c );
 }
 
+_WCRTLINK int fputc( int c, FILE *fp )
+{
+    _ValidFile( fp, EOF );
+    _AccessFile( fp );
+    c = fputc_unlocked( c, fp );
+    _ReleaseFile( fp );
+    return( c );
+}
+
 
 #else
 
@@ -46,17 +46,15 @@
 extern int  __fill_buffer( FILE * );    /* located in fgetc */
 
 
-_WCRTLINK size_t fread( void *_buf, size_t size, size_t n, FILE *fp )
+_WCRTLINK size_t fread_unlocked( void *_buf, size_t size, size_t n, FILE *fp )
 {
     unsigned char   *buf = _buf;
     size_t          len_read;
 
     _ValidFile( fp, 0 );
-    _AccessFile( fp );
     if( (fp->_flag & _READ) == 0 ) {
         __set_errno( EBADF );
         fp->_flag |= _SFERR;
-        _ReleaseFile( fp );
         return( 0 );
     }
 
@@ -71,7 +69,6 @@ _WCRTLINK size_t fread( void *_buf, size_t size, size_t n, FILE *fp )
 
     n *= size;
     if( n == 0 ) {
-        _ReleaseFile( fp );
         return( n );
     }
     if( _FP_BASE(fp) == NULL ) {
@@ -162,6 +159,16 @@ _WCRTLINK size_t fread( void *_buf, size_t size, size_t n, FILE *fp )
         }
 #endif
     }
-    _ReleaseFile( fp );
     return( len_read / size );
 }
+
+_WCRTLINK size_t fread( void *_buf, size_t size, size_t n, FILE *fp )
+{
+    size_t  count;
+
+    _ValidFile( fp, 0 );
+    _AccessFile( fp );
+    count = fread_unlocked( _buf, size, n, fp );
+    _ReleaseFile( fp );
+    return( count );
+}
@@ -42,22 +42,19 @@
 #include "streamio.h"
 
 
-_WCRTLINK size_t fwrite( const void *buf, size_t size, size_t n, FILE *fp )
+_WCRTLINK size_t fwrite_unlocked( const void *buf, size_t size, size_t n, FILE *fp )
 {
     size_t      count;
     unsigned    oflag;
 
     _ValidFile( fp, 0 );
-    _AccessFile( fp );
     if( (fp->_flag & _WRITE) == 0 ) {
         __set_errno( EBADF );
         fp->_flag |= _SFERR;
-        _ReleaseFile( fp );
         return( 0 );        /* POSIX says return 0 */
     }
     n *= size;
     if( n == 0 ) {
-        _ReleaseFile( fp );
         return( n );
     }
     if( _FP_BASE(fp) == NULL ) {
@@ -125,14 +122,14 @@ _WCRTLINK size_t fwrite( const void *buf, size_t size, size_t n, FILE *fp )
             fp->_flag |= _IOFBF;
         }
 
-        /*** Use fputc, and make it think the stream is byte-oriented ***/
+        /*** Use fputc_unlocked, and make it think the stream is byte-oriented ***/
     #ifndef __NETWARE__
         old_orientation = _FP_ORIENTATION(fp);
         _FP_ORIENTATION(fp) = _BYTE_ORIENTED;
     #endif
         bufptr = (const char *)buf;
         do {
-            fputc( *(bufptr++), fp );
+            fputc_unlocked( *(bufptr++), fp );
             if( fp->_flag & (_EOF | _SFERR) ) break;
             ++count;
         } while( count != n );
@@ -156,6 +153,16 @@ _WCRTLINK size_t fwrite( const void *buf, size_t size, size_t n, FILE *fp )
         count = 0;
     }
     fp->_flag |= oflag;                     /* JBS 27-jan-92 */
-    _ReleaseFile( fp );
     return( count / size );
 }
+
+_WCRTLINK size_t fwrite( const void *buf, size_t size, size_t n, FILE *fp )
+{
+    size_t  count;
+
+    _ValidFile( fp, 0 );
+    _AccessFile( fp );
+    count = fwrite_unlocked( buf, size, n, fp );
+    _ReleaseFile( fp );
+    return( count );
+}
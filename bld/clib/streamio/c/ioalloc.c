@@ -33,12 +33,22 @@
 #include <stdio.h>
 #include "liballoc.h"
 #include <unistd.h>
+#if defined( __LINUX__ )
+    #include <sys/stat.h>
+#endif
 #include "rtdata.h"
 #include "streamio.h"
 
+#if defined( __LINUX__ )
+    #define MAX_BUFSIZ      (64*1024U)  /* cap on a block size from fstat() */
+#endif
 
 void __ioalloc( FILE *fp )
 {
+#if defined( __LINUX__ )
+    struct stat     st;
+#endif
+
     __chktty( fp );                                 /* JBS 28-aug-90 */
     if( fp->_bufsize == 0 ) {
         if( fp->_flag & _IOLBF ) {
@@ -52,6 +62,15 @@ void __ioalloc( FILE *fp )
             fp->_bufsize = 64;
         } else {
             fp->_bufsize = BUFSIZ;
+#if defined( __LINUX__ )
+            /* use the file system's preferred I/O size if that is larger */
+            if( fstat( fileno( fp ), &st ) == 0 && st.st_blksize > BUFSIZ ) {
+                fp->_bufsize = MAX_BUFSIZ;
+                if( st.st_blksize < MAX_BUFSIZ ) {
+                    fp->_bufsize = st.st_blksize;
+                }
+            }
+#endif
         }
     }
     _FP_BASE(fp) = lib_malloc( fp->_bufsize );
@@ -683,6 +683,61 @@ int Test_ungetc( void )
     return( 1 );
 }
 
+int Test_unlocked( void )
+/***********************/
+{
+    FILE    *fp;
+    char    *big;
+    size_t  big_size;
+    size_t  i;
+    char    buff[4];
+    char    filename[ L_tmpnam ];
+    char    cur_mode[10] = "unlocked";
+
+    /* larger than any stream buffer, so fread/fwrite go around it */
+#if defined( _M_I86 )
+    big_size = 8 * 1024U + 3;
+#else
+    big_size = 256 * 1024U + 3;
+#endif
+    big = malloc( big_size );
+    INTERNAL( big != NULL );
+    for( i = 0; i < big_size; ++i ) {
+        big[i] = (char)( i * 7 );
+    }
+
+    VERIFY( tmpnam( filename ) != NULL );
+    VERIFY( (fp = fopen( filename, "w+b" )) != NULL );
+    VERIFY( putc_unlocked( 'a', fp ) == 'a' );
+    VERIFY( fputc_unlocked( 'b', fp ) == 'b' );
+    VERIFY( fwrite_unlocked( "cd", 1, 2, fp ) == 2 );
+    VERIFY( fwrite( big, 1, big_size, fp ) == big_size );
+    VERIFY( fputc( 'z', fp ) == 'z' );
+
+    VERIFY( fseek( fp, 0, SEEK_SET ) == 0 );
+    VERIFY( getc_unlocked( fp ) == 'a' );
+    VERIFY( fgetc_unlocked( fp ) == 'b' );
+    VERIFY( fread_unlocked( buff, 1, 2, fp ) == 2 );
+    VERIFY( buff[0] == 'c' && buff[1] == 'd' );
+    memset( big, 0, big_size );
+    VERIFY( fread( big, 1, big_size, fp ) == big_size );
+    for( i = 0; i < big_size; ++i ) {
+        if( big[i] != (char)( i * 7 ) ) {
+            break;
+        }
+    }
+    VERIFY( i == big_size );
+    VERIFY( getc_unlocked( fp ) == 'z' );
+    VERIFY( getc_unlocked( fp ) == EOF );
+    VERIFY( feof( fp ) );
+
+    fclose( fp );
+    free( big );
+    EXPECT( remove( filename ) == 0 );
+
+    return( 1 );
+}
+
 
 int main( int argc, char *argv[] )
 /********************************/
@@ -746,6 +801,7 @@ int main( int argc, char *argv[] )
     Test_setbuf( );
     Test_setvbuf( );
     Test_ungetc( );
+    Test_unlocked( );
 
     fprintf( old_stdout, "Tests completed (%s).\n", strlwr( argv[0] ) );
     fclose( old_stdout );
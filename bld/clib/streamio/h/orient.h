@@ -32,6 +32,7 @@
 #ifdef __NETWARE__
     /* One less thing to worry about */
     #define ORIENT_STREAM(stream,error_return)
+    #define ORIENT_STREAM_UNLOCKED(stream,error_return)
 #else
   #ifdef __WIDECHAR__
     #define ORIENT_STREAM(stream,error_return)                  \
@@ -53,5 +54,14 @@
                 return( error_return );                         \
             }                                                   \
     }
+    /* for the *_unlocked() functions, which hold no lock to release */
+    #define ORIENT_STREAM_UNLOCKED(stream,error_return)         \
+        if( _FP_ORIENTATION(stream) != _BYTE_ORIENTED ) {       \
+            if( _FP_ORIENTATION(stream) == _NOT_ORIENTED ) {    \
+                _FP_ORIENTATION(stream) = _BYTE_ORIENTED;       \
+            } else {                                            \
+                return( error_return );                         \
+            }                                                   \
+        }
   #endif
 #endif
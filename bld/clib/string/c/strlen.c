@@ -34,6 +34,9 @@
 #include <stdio.h>
 #include "xstring.h"
 #include "riscstr.h"
+#if defined(__386__) && !defined(__WIDECHAR__)
+ #include "strscan.h"
+#endif
 #undef  strlen
 
 
@@ -44,7 +47,26 @@
 #endif
 {
 
-#if defined(__INLINE_FUNCTIONS__) && !defined(__WIDECHAR__) && defined(_M_IX86)
+#if defined(__386__) && !defined(__WIDECHAR__)
+    const char          *p;
+    const unsigned long *w;
+
+  #if defined(__SSE2_STRING__)
+    if( __cpu_features & CPU_SSE2 )
+        return( __sse2_strlen( s ) );
+  #endif
+    /* aligned words never straddle a page the string does not reach */
+    for( p = s; !WORD_ALIGNED( p ); ++p ) {
+        if( *p == NULLCHAR ) {
+            return( p - s );
+        }
+    }
+    for( w = (const unsigned long *)p; !HAS_NUL_BYTE( *w ); ++w )
+        ;
+    for( p = (const char *)w; *p != NULLCHAR; ++p )
+        ;
+    return( p - s );
+#elif defined(__INLINE_FUNCTIONS__) && !defined(__WIDECHAR__) && defined(_M_IX86)
     return( _inline_strlen( s ) );
 #else
     const CHAR_TYPE *p;
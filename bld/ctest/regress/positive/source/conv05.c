@@ -0,0 +1,75 @@
+#include "fail.h"
+
+/* float to integer conversions truncate toward zero (-fps on 386) */
+
+volatile float  f;
+volatile double d;
+
+static long ftol( float x )
+{
+    return( (long)x );
+}
+
+static long dtol( double x )
+{
+    return( (long)x );
+}
+
+int main( void )
+{
+    int             i;
+    short           s;
+    signed char     c;
+    unsigned        u;
+
+    f = 2.75f;
+    i = f;
+    if( i != 2 ) fail( __LINE__ );
+    f = -2.75f;
+    i = f;
+    if( i != -2 ) fail( __LINE__ );
+    f = 0.5f;
+    i = f;
+    if( i != 0 ) fail( __LINE__ );
+    f = -0.5f;
+    i = f;
+    if( i != 0 ) fail( __LINE__ );
+
+    d = 7.999;
+    i = d;
+    if( i != 7 ) fail( __LINE__ );
+    d = -7.999;
+    i = d;
+    if( i != -7 ) fail( __LINE__ );
+    d = -1.0;
+    i = d;
+    if( i != -1 ) fail( __LINE__ );
+
+    d = 1234.9;
+    s = d;
+    if( s != 1234 ) fail( __LINE__ );
+    d = -1234.9;
+    s = d;
+    if( s != -1234 ) fail( __LINE__ );
+    f = -99.9f;
+    c = f;
+    if( c != -99 ) fail( __LINE__ );
+    d = 30000.7;
+    u = d;
+    if( u != 30000 ) fail( __LINE__ );
+
+    if( ftol( 123456.75f ) != 123456L ) fail( __LINE__ );
+    if( ftol( -123456.75f ) != -123456L ) fail( __LINE__ );
+    if( dtol( 2147483647.9 ) != 2147483647L ) fail( __LINE__ );
+    if( dtol( -2147483648.9 ) != (-2147483647L - 1) ) fail( __LINE__ );
+#if defined( __386__ ) && defined( __SW_FPS )
+    /* out of range values give the integer indefinite, like fistp */
+    if( dtol( 3e9 ) != (-2147483647L - 1) ) fail( __LINE__ );
+    if( dtol( -3e9 ) != (-2147483647L - 1) ) fail( __LINE__ );
+    if( ftol( 1e20f ) != (-2147483647L - 1) ) fail( __LINE__ );
+    d = 1e100;
+    i = d;
+    if( i != (-2147483647 - 1) ) fail( __LINE__ );
+#endif
+    _PASS;
+}
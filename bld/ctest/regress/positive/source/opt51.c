@@ -0,0 +1,65 @@
+#include "fail.h"
+
+/* parameters that get the same constant from every call */
+
+static int scale( int x, int k )
+{
+    return( x * k + k );
+}
+
+static int mixed( int x, int k )
+{
+    return( x - k );
+}
+
+static int bump( int k )
+{
+    k += 2;
+    return( k );
+}
+
+static int peek( int k )
+{
+    int *p = &k;
+
+    *p = 7;
+    return( k );
+}
+
+static int shift( unsigned char c, long l )
+{
+    return( (int)( ( l >> c ) & 0xff ) );
+}
+
+static int count( int n, int step )
+{
+    if( n <= 0 ) return( 0 );
+    return( 1 + count( n - step, step ) );
+}
+
+static int taken( int k )
+{
+    return( k * 2 );
+}
+
+int (*fp)( int ) = taken;
+
+int main( void )
+{
+    int i;
+
+    for( i = 0; i < 4; ++i ) {
+        if( scale( i, 3 ) != i * 3 + 3 ) fail( __LINE__ );
+    }
+    if( mixed( 10, 1 ) != 9 ) fail( __LINE__ );
+    if( mixed( 10, 4 ) != 6 ) fail( __LINE__ );
+    if( bump( 5 ) != 7 ) fail( __LINE__ );
+    if( bump( 5 ) != 7 ) fail( __LINE__ );
+    if( peek( 1 ) != 7 ) fail( __LINE__ );
+    if( shift( 8, 0x12345678L ) != 0x56 ) fail( __LINE__ );
+    if( shift( 8, 0x12345678L ) != 0x56 ) fail( __LINE__ );
+    if( count( 10, 2 ) != 5 ) fail( __LINE__ );
+    if( taken( 4 ) != 8 ) fail( __LINE__ );
+    if( fp( 5 ) != 10 ) fail( __LINE__ );
+    _PASS;
+}
@@ -0,0 +1,92 @@
+#include "fail.h"
+
+/* fill and copy loops that may become string instructions */
+
+#define N   37
+
+char            c1[N];
+char            c2[N];
+short           s1[N];
+int             i1[N];
+int             i2[N];
+unsigned long   u1[N];
+
+static void fill( char *p, int n, char c )
+{
+    int i;
+
+    for( i = 0; i < n; ++i ) {
+        p[i] = c;
+    }
+}
+
+static int tail( int *p, int from, int n )
+{
+    int i;
+
+    i = from;
+    while( i < n ) {
+        p[i] = -1;
+        i++;
+    }
+    return( i );
+}
+
+static int check( char *p, int lo, int hi, int v )
+{
+    int i;
+
+    for( i = lo; i < hi; ++i ) {
+        if( p[i] != (char)v ) return( 0 );
+    }
+    return( 1 );
+}
+
+int main( void )
+{
+    int         i;
+    int         n;
+    int         *pn;
+    unsigned    u;
+
+    for( i = 0; i < N; ++i ) c1[i] = 'x';
+    if( i != N ) fail( __LINE__ );
+    if( !check( c1, 0, N, 'x' ) ) fail( __LINE__ );
+
+    for( i = 3; i < N; i += 1 ) s1[i] = 0x0101;
+    if( i != N ) fail( __LINE__ );
+    if( s1[2] != 0 || s1[3] != 0x0101 || s1[N-1] != 0x0101 ) fail( __LINE__ );
+
+    for( i = 0; i < N; i++ ) i1[i] = 0x01020304;
+    if( i1[0] != 0x01020304 || i1[N-1] != 0x01020304 ) fail( __LINE__ );
+
+    for( u = 0; u < N; ++u ) u1[u] = ~0UL;
+    if( u != N || u1[0] != ~0UL || u1[N-1] != ~0UL ) fail( __LINE__ );
+
+    for( i = 0; i < N; ++i ) i2[i] = i1[i];
+    if( i2[0] != 0x01020304 || i2[N-1] != 0x01020304 ) fail( __LINE__ );
+
+    for( i = 0; i < N; ++i ) c2[i] = c1[i];
+    if( !check( c2, 0, N, 'x' ) ) fail( __LINE__ );
+
+    fill( c1, 10, 'a' );
+    if( !check( c1, 0, 10, 'a' ) || !check( c1, 10, N, 'x' ) ) fail( __LINE__ );
+    fill( c1 + 20, 0, 'b' );
+    if( !check( c1, 10, N, 'x' ) ) fail( __LINE__ );
+
+    if( tail( i1, 5, 9 ) != 9 ) fail( __LINE__ );
+    if( i1[4] != 0x01020304 || i1[5] != -1 || i1[8] != -1 ) fail( __LINE__ );
+    if( i1[9] != 0x01020304 ) fail( __LINE__ );
+    if( tail( i1, 12, 7 ) != 12 ) fail( __LINE__ );
+    if( i1[10] != 0x01020304 ) fail( __LINE__ );
+
+    /* the store through pn ends this loop early */
+    n = N;
+    pn = &n;
+    for( i = 0; i < n; ++i ) {
+        pn[i] = 0;
+    }
+    if( i != 1 || n != 0 ) fail( __LINE__ );
+
+    _PASS;
+}
@@ -0,0 +1,42 @@
+#include "fail.h"
+
+/* routines picked for speed or size by a profile (-ot -fsp=opt53.csv) */
+
+int prof_before( int x )
+{
+    return( x + 1 );
+}
+
+/* listed without samples: compiled for size, so not aligned */
+int prof_cold( int x )
+{
+    return( x * 3 );
+}
+
+/* not listed: -ot from the command line */
+int prof_plain( int x )
+{
+    return( x - 1 );
+}
+
+/* listed with most of the samples: compiled for speed */
+int prof_hot( int x )
+{
+    return( x * 5 );
+}
+
+int main( void )
+{
+    if( prof_before( 1 ) != 2 ) fail( __LINE__ );
+    if( prof_cold( 2 ) != 6 ) fail( __LINE__ );
+    if( prof_plain( 3 ) != 2 ) fail( __LINE__ );
+    if( prof_hot( 4 ) != 20 ) fail( __LINE__ );
+#if defined( __WATCOMC__ ) && defined( __386__ )
+    /* routines compiled for speed start on a 16 byte boundary... */
+    if( (unsigned long)prof_plain % 16 != 0 ) fail( __LINE__ );
+    if( (unsigned long)prof_hot % 16 != 0 ) fail( __LINE__ );
+    /* ...while one compiled for size follows the last one's ret */
+    if( ((unsigned char *)prof_cold)[-1] != 0xC3 ) fail( __LINE__ );
+#endif
+    _PASS;
+}
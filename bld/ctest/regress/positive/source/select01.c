@@ -0,0 +1,145 @@
+#include "fail.h"
+#include <limits.h>
+
+/* selects that may be done without branches (-6 and up) */
+
+#define SELECTS( t, n ) \
+static t max1_##n( t a, t b ) \
+{ \
+    t   x; \
+    x = b; \
+    if( a > b ) x = a; \
+    return( x ); \
+} \
+static t max2_##n( t a, t b ) \
+{ \
+    t   x; \
+    if( a > b ) { \
+        x = a; \
+    } else { \
+        x = b; \
+    } \
+    return( x ); \
+} \
+static t min1_##n( t a, t b ) \
+{ \
+    t   x; \
+    x = a; \
+    if( b < a ) x = b; \
+    return( x ); \
+} \
+static t min2_##n( t a, t b ) \
+{ \
+    t   x; \
+    if( a < b ) { \
+        x = a; \
+    } else { \
+        x = b; \
+    } \
+    return( x ); \
+} \
+static t clamp1_##n( t v, t lo, t hi ) \
+{ \
+    t   x; \
+    x = v; \
+    if( x < lo ) x = lo; \
+    if( x > hi ) x = hi; \
+    return( x ); \
+} \
+static t clamp2_##n( t v, t lo, t hi ) \
+{ \
+    t   x; \
+    if( v < lo ) { \
+        x = lo; \
+    } else if( v > hi ) { \
+        x = hi; \
+    } else { \
+        x = v; \
+    } \
+    return( x ); \
+} \
+static t sign_##n( t a, t b ) \
+{ \
+    t   x; \
+    if( a < b ) { \
+        x = 7; \
+    } else { \
+        x = 100; \
+    } \
+    return( x ); \
+} \
+static void check_##n( t *vals, int num, int line ) \
+{ \
+    int i; \
+    int j; \
+    t   a; \
+    t   b; \
+    t   lo; \
+    t   hi; \
+    t   x; \
+    for( i = 0; i < num; ++i ) { \
+        for( j = 0; j < num; ++j ) { \
+            a = vals[i]; \
+            b = vals[j]; \
+            x = max1_##n( a, b ); \
+            if( x < a || x < b || ( x != a && x != b ) ) fail( line ); \
+            if( max2_##n( a, b ) != x ) fail( line ); \
+            x = min1_##n( a, b ); \
+            if( x > a || x > b || ( x != a && x != b ) ) fail( line ); \
+            if( min2_##n( a, b ) != x ) fail( line ); \
+            if( a < b ) { \
+                if( sign_##n( a, b ) != 7 ) fail( line ); \
+            } else { \
+                if( sign_##n( a, b ) != 100 ) fail( line ); \
+            } \
+            lo = min2_##n( a, b ); \
+            hi = max2_##n( a, b ); \
+            x = clamp1_##n( vals[(i+j)%num], lo, hi ); \
+            if( x < lo || x > hi ) fail( line ); \
+            if( vals[(i+j)%num] >= lo && vals[(i+j)%num] <= hi \
+             && x != vals[(i+j)%num] ) fail( line ); \
+            if( clamp2_##n( vals[(i+j)%num], lo, hi ) != x ) fail( line ); \
+        } \
+    } \
+}
+
+SELECTS( signed char, sc )
+SELECTS( unsigned char, uc )
+SELECTS( short, ss )
+SELECTS( unsigned short, us )
+SELECTS( int, si )
+SELECTS( unsigned, ui )
+
+signed char     sc_vals[] = { 0, 1, -1, 2, -2, 100, -100, SCHAR_MAX, SCHAR_MIN };
+unsigned char   uc_vals[] = { 0, 1, 2, 127, 128, 200, UCHAR_MAX };
+short           ss_vals[] = { 0, 1, -1, 300, -300, SHRT_MAX, SHRT_MIN, 255, -256 };
+unsigned short  us_vals[] = { 0, 1, 255, 256, 0x7fff, 0x8000, USHRT_MAX };
+int             si_vals[] = { 0, 1, -1, 1000, -1000, INT_MAX, INT_MIN, 65535, -65536 };
+unsigned        ui_vals[] = { 0, 1, 255, 0x7fff, 0x8000, UINT_MAX / 2 + 1, UINT_MAX };
+
+#define NUM( a )        ( sizeof( a ) / sizeof( a[0] ) )
+
+/* a conditional store to memory must stay conditional */
+int             g;
+
+static void set_g( int a, int b )
+{
+    if( a > b ) g = a;
+}
+
+int main( void )
+{
+    check_sc( sc_vals, NUM( sc_vals ), __LINE__ );
+    check_uc( uc_vals, NUM( uc_vals ), __LINE__ );
+    check_ss( ss_vals, NUM( ss_vals ), __LINE__ );
+    check_us( us_vals, NUM( us_vals ), __LINE__ );
+    check_si( si_vals, NUM( si_vals ), __LINE__ );
+    check_ui( ui_vals, NUM( ui_vals ), __LINE__ );
+
+    g = 5;
+    set_g( 1, 2 );
+    if( g != 5 ) fail( __LINE__ );
+    set_g( 3, 2 );
+    if( g != 3 ) fail( __LINE__ );
+    _PASS;
+}
@@ -44,6 +44,13 @@
         #define _DOSERRNO       _doserrno
 
     #endif
+#elif defined(__LINUX__) && defined(__SW_BM)
+
+    #include "thread.h"
+
+    #define _ERRNO  (__THREADDATAPTR->__errnoP)
+    #define _DOSERRNO       _doserrno
+
 #elif defined(__RDOSDEV__)
     #define _ERRNO  errno
     #define _DOSERRNO       _doserrno    
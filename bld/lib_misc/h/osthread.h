@@ -35,7 +35,7 @@
 #if defined(__QNX__)
   #include <semaphor.h>
 #elif defined(__LINUX__)
-// TODO: Include Linux specific thread header files
+  #include <sys/types.h>
 #elif defined(__NT__)
   #include <windows.h>
   #include <ntex.h>
@@ -64,7 +64,6 @@
   #include <semaphor.h>
   #include <sys/types.h>
 #elif defined(__LINUX__)
-// TODO: Linux thread stuff goes here!
   #include <sys/types.h>
 #elif defined(__RDOSDEV__)
   #include <rdosdev.h>
@@ -90,7 +89,7 @@ typedef struct  semaphore_object {
   #elif defined(__QNX__)
         sem_t           semaphore;
   #elif defined(__LINUX__)
-    // TODO: Linux semaphore goes here!
+        volatile int    semaphore; // futex lock word, see lnxthrd.h
   #elif defined(__RDOS__)
         int             semaphore; // RDOS only have critical sections, which should work
   #elif defined(__RDOSDEV__)
@@ -145,9 +144,11 @@ struct wcpp_thread_ctl {
 /* stack checking routine assumes "__stklowP" is first field */
 typedef struct thread_data {
     unsigned                    __stklowP;
-    #if !defined(__QNX__) && !defined(__LINUX__) && !defined(__RDOSDEV__)
+    #if !defined(__QNX__) && !defined(__RDOSDEV__)
         int                     __errnoP;
+      #if !defined(__LINUX__)
         int                     __doserrnoP;
+      #endif
     #endif
     #if defined(__OS2_286__)
         struct wcpp_thread_ctl  _wint_thread_data;
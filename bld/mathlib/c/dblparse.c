@@ -0,0 +1,151 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Decimal to double conversion by the Eisel-Lemire algorithm.
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include "xfloat.h"
+#include "pow5tab.h"
+
+/*
+ * Daniel Lemire, "Number Parsing at a Gigabyte per Second" (2021), after
+ * Michael Eisel. w * 10^q is computed as w * 5^q * 2^q, taking only the
+ * 64 (or, when the result is too close to call, 128) leading bits of the
+ * product of w with the table entry for 5^q. For a w of up to 19 digits
+ * this always gives the correctly rounded double, ties to even.
+ */
+
+typedef unsigned long long  uint64;
+
+#define MANT_BITS       52
+#define MIN_EXP         (-1023)
+#define INF_EXP         0x7FF
+#define MIN_POW10       (-342)
+#define MAX_POW10       308
+
+static uint64 mul64x64( uint64 a, uint64 b, uint64 *hi )
+/******************************************************/
+{
+    uint64  a_lo = a & 0xFFFFFFFF;
+    uint64  a_hi = a >> 32;
+    uint64  b_lo = b & 0xFFFFFFFF;
+    uint64  b_hi = b >> 32;
+    uint64  lolo = a_lo * b_lo;
+    uint64  hilo = a_hi * b_lo;
+    uint64  lohi = a_lo * b_hi;
+    uint64  mid;
+
+    mid = (lolo >> 32) + (hilo & 0xFFFFFFFF) + (lohi & 0xFFFFFFFF);
+    *hi = a_hi * b_hi + (hilo >> 32) + (lohi >> 32) + (mid >> 32);
+    return( (mid << 32) | (lolo & 0xFFFFFFFF) );
+}
+
+/*
+ * Store w * 10^q, rounded to nearest, in *result. The result is 0 if
+ * 128 bits of the product were not enough to settle the rounding, and
+ * the caller must then convert the number some other way.
+ */
+int __DblFromDec( uint64 w, int q, double *result )
+/*************************************************/
+{
+    union {
+        double      d;
+        uint64      u;
+    }               bits;
+    const uint64    *t;
+    uint64          hi;
+    uint64          lo;
+    uint64          hi2;
+    uint64          mant;
+    int             lz;
+    int             upper;
+    int             shift;
+    int             power2;
+
+    if( w == 0 || q < MIN_POW10 ) {
+        bits.u = 0;
+    } else if( q > MAX_POW10 ) {
+        bits.u = (uint64)INF_EXP << MANT_BITS;
+    } else {
+        for( lz = 0; (w >> 63) == 0; ++lz ) {
+            w <<= 1;
+        }
+        t = __Pow5Tab128[q - POW5_TAB_MIN];
+        lo = mul64x64( w, t[0], &hi );
+        if( (hi & 0x1FF) == 0x1FF ) {
+            // the low bits may carry into the 55 we keep
+            mul64x64( w, t[1], &hi2 );
+            lo += hi2;
+            if( lo < hi2 ) {
+                ++hi;
+            }
+            if( lo == ~(uint64)0 && ( q < -27 || q > 55 ) ) {
+                return( 0 );
+            }
+        }
+        upper = (int)( hi >> 63 );
+        shift = upper + 64 - MANT_BITS - 3;
+        mant = hi >> shift;
+        // floor(log2(10^q)) + 63, then adjusted for the normalization
+        power2 = (int)( ( (long)q * (152170L + 65536L) ) >> 16 ) + 63;
+        power2 += upper - lz - MIN_EXP;
+        if( power2 <= 0 ) {
+            // subnormal, or underflow to zero
+            if( -power2 + 1 >= 64 ) {
+                bits.u = 0;
+            } else {
+                mant >>= -power2 + 1;
+                mant += ( mant & 1 );
+                mant >>= 1;
+                power2 = ( mant < ((uint64)1 << MANT_BITS) ) ? 0 : 1;
+                bits.u = ( (uint64)power2 << MANT_BITS ) | mant;
+            }
+        } else {
+            // an exact halfway case rounds to even rather than up
+            if( lo <= 1 && q >= -4 && q <= 23 && (mant & 3) == 1
+              && ( mant << shift ) == hi ) {
+                mant &= ~(uint64)1;
+            }
+            mant += ( mant & 1 );
+            mant >>= 1;
+            if( mant >= ((uint64)2 << MANT_BITS) ) {
+                mant = (uint64)1 << MANT_BITS;
+                ++power2;
+            }
+            mant &= ~((uint64)1 << MANT_BITS);
+            if( power2 >= INF_EXP ) {
+                power2 = INF_EXP;
+                mant = 0;
+            }
+            bits.u = ( (uint64)power2 << MANT_BITS ) | mant;
+        }
+    }
+    *result = bits.d;
+    return( 1 );
+}
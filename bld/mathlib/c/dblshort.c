@@ -0,0 +1,301 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Shortest round-trip decimal digits of a double (Ryu).
+*
+****************************************************************************/
+
+
+#include "variety.h"
+#include "xfloat.h"
+#include "pow5tab.h"
+
+/*
+ * This is the Ryu algorithm of Ulf Adams (PLDI 2018). It finds the
+ * shortest string of decimal digits that reads back as the same double,
+ * and of those the one closest to the exact value, using only 64-bit
+ * integer arithmetic. Its multipliers are derived from the shared
+ * table in pow5tab.c instead of tables of its own:
+ *
+ *      5^i / 2^(pow5bits(i)-125)       is entry i shifted right by 3
+ *      2^(pow5bits(i)+124) / 5^i + 1   is (entry -i, less one if the
+ *                                      entry was rounded up) shifted
+ *                                      right by 3, plus one
+ */
+
+typedef unsigned long long  uint64;
+
+#define MANT_BITS       52
+#define EXP_BIAS        1023
+#define POW5_BITS       125
+
+/* ceil(log2(5^e)), floor(log10(2^e)) and floor(log10(5^e)), all exact
+ * for the range used here */
+#define pow5bits( e )   ((int)(((unsigned long)(e) * 1217359UL) >> 19) + 1)
+#define log10pow2( e )  ((int)(((unsigned long)(e) * 78913UL) >> 18))
+#define log10pow5( e )  ((int)(((unsigned long)(e) * 732923UL) >> 20))
+
+static uint64 mul64x64( uint64 a, uint64 b, uint64 *hi )
+/******************************************************/
+{
+    uint64  a_lo = a & 0xFFFFFFFF;
+    uint64  a_hi = a >> 32;
+    uint64  b_lo = b & 0xFFFFFFFF;
+    uint64  b_hi = b >> 32;
+    uint64  lolo = a_lo * b_lo;
+    uint64  hilo = a_hi * b_lo;
+    uint64  lohi = a_lo * b_hi;
+    uint64  mid;
+
+    mid = (lolo >> 32) + (hilo & 0xFFFFFFFF) + (lohi & 0xFFFFFFFF);
+    *hi = a_hi * b_hi + (hilo >> 32) + (lohi >> 32) + (mid >> 32);
+    return( (mid << 32) | (lolo & 0xFFFFFFFF) );
+}
+
+/* (m * mul) >> j for a 125 or 126-bit mul and 64 < j < 128 */
+static uint64 mulShift( uint64 m, const uint64 *mul, int j )
+/**********************************************************/
+{
+    uint64  hi0;
+    uint64  hi1;
+    uint64  lo1;
+    uint64  sum;
+
+    mul64x64( m, mul[0], &hi0 );
+    lo1 = mul64x64( m, mul[1], &hi1 );
+    sum = hi0 + lo1;
+    if( sum < hi0 ) {
+        ++hi1;
+    }
+    j -= 64;
+    return( (hi1 << (64 - j)) | (sum >> j) );
+}
+
+/* multiplier for 5^i, low half first */
+static void pow5Split( int i, uint64 *mul )
+/*****************************************/
+{
+    const uint64    *t;
+
+    t = __Pow5Tab128[i - POW5_TAB_MIN];
+    mul[0] = (t[1] >> 3) | (t[0] << 61);
+    mul[1] = t[0] >> 3;
+}
+
+/* multiplier for 5^-i, low half first */
+static void pow5InvSplit( int i, uint64 *mul )
+/********************************************/
+{
+    const uint64    *t;
+    uint64          lo;
+    uint64          hi;
+
+    if( i == 0 ) {
+        mul[0] = 1;
+        mul[1] = (uint64)1 << 61;
+        return;
+    }
+    t = __Pow5Tab128[-i - POW5_TAB_MIN];
+    hi = t[0];
+    lo = t[1];
+    if( i <= 27 ) {
+        if( lo-- == 0 ) {
+            --hi;
+        }
+    }
+    lo = ((lo >> 3) | (hi << 61)) + 1;
+    hi = (hi >> 3) + (lo == 0);
+    mul[0] = lo;
+    mul[1] = hi;
+}
+
+static int pow5Factor( uint64 value )
+/***********************************/
+{
+    int     count;
+
+    for( count = 0; value % 5 == 0; ++count ) {
+        value /= 5;
+    }
+    return( count );
+}
+
+#define multipleOfPow5( v, p )  (pow5Factor( v ) >= (p))
+#define multipleOfPow2( v, p )  (((v) & (((uint64)1 << (p)) - 1)) == 0)
+
+/*
+ * Store the shortest digits of the finite, positive and nonzero d in
+ * digits, without a terminator, and the decimal exponent of the first
+ * one in *xexp. The result is the number of digits, at most 17.
+ */
+int __DblShortest( double d, char *digits, int *xexp )
+/****************************************************/
+{
+    union {
+        double      d;
+        uint64      u;
+    }               bits;
+    uint64          mant;
+    uint64          m2;
+    uint64          mv;
+    uint64          vr;
+    uint64          vp;
+    uint64          vm;
+    uint64          mul[2];
+    uint64          output;
+    int             ieee_exp;
+    int             e2;
+    int             e10;
+    int             q;
+    int             i;
+    int             len;
+    int             even;
+    int             mm_shift;
+    int             vm_zeros;
+    int             vr_zeros;
+    int             removed;
+    int             last_digit;
+    int             round_up;
+
+    bits.d = d;
+    mant = bits.u & (((uint64)1 << MANT_BITS) - 1);
+    ieee_exp = (int)(bits.u >> MANT_BITS) & 0x7FF;
+    if( ieee_exp == 0 ) {
+        e2 = 1 - EXP_BIAS - MANT_BITS - 2;
+        m2 = mant;
+    } else {
+        e2 = ieee_exp - EXP_BIAS - MANT_BITS - 2;
+        m2 = ((uint64)1 << MANT_BITS) | mant;
+    }
+    even = ( (m2 & 1) == 0 );
+
+    // the interval of values that read back as d is (mm, mp) * 2^e2,
+    // with mm = mv - 1 - mm_shift and mp = mv + 2; both ends belong to
+    // it when m2 is even
+    mv = 4 * m2;
+    mm_shift = ( mant != 0 || ieee_exp <= 1 );
+
+    // scale mv, mp and mm by a power of ten to 64-bit integers vr, vp, vm
+    vm_zeros = 0;
+    vr_zeros = 0;
+    if( e2 >= 0 ) {
+        q = log10pow2( e2 ) - ( e2 > 3 );
+        e10 = q;
+        i = -e2 + q + POW5_BITS + pow5bits( q ) - 1;
+        pow5InvSplit( q, mul );
+        vr = mulShift( mv, mul, i );
+        vp = mulShift( mv + 2, mul, i );
+        vm = mulShift( mv - 1 - mm_shift, mul, i );
+        if( q <= 21 ) {
+            // only one of mp, mv and mm can be a multiple of 5
+            if( mv % 5 == 0 ) {
+                vr_zeros = multipleOfPow5( mv, q );
+            } else if( even ) {
+                vm_zeros = multipleOfPow5( mv - 1 - mm_shift, q );
+            } else {
+                vp -= multipleOfPow5( mv + 2, q );
+            }
+        }
+    } else {
+        q = log10pow5( -e2 ) - ( -e2 > 1 );
+        e10 = q + e2;
+        i = -e2 - q;
+        pow5Split( i, mul );
+        i = q - ( pow5bits( i ) - POW5_BITS );
+        vr = mulShift( mv, mul, i );
+        vp = mulShift( mv + 2, mul, i );
+        vm = mulShift( mv - 1 - mm_shift, mul, i );
+        if( q <= 1 ) {
+            // mv has at least two trailing zero bits, mp at least one
+            vr_zeros = 1;
+            if( even ) {
+                vm_zeros = ( mm_shift == 1 );
+            } else {
+                --vp;
+            }
+        } else if( q < 63 ) {
+            vr_zeros = multipleOfPow2( mv, q );
+        }
+    }
+
+    // drop digits while the interval still holds a shorter number
+    removed = 0;
+    last_digit = 0;
+    if( vm_zeros || vr_zeros ) {
+        // rare case where the ends and the rounding need exact care
+        while( vp / 10 > vm / 10 ) {
+            vm_zeros &= ( vm % 10 == 0 );
+            vr_zeros &= ( last_digit == 0 );
+            last_digit = (int)( vr % 10 );
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        if( vm_zeros ) {
+            while( vm % 10 == 0 ) {
+                vr_zeros &= ( last_digit == 0 );
+                last_digit = (int)( vr % 10 );
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+        }
+        if( vr_zeros && last_digit == 5 && vr % 2 == 0 ) {
+            last_digit = 4;             // exactly halfway, round to even
+        }
+        output = vr + ( (vr == vm && ( !even || !vm_zeros )) || last_digit >= 5 );
+    } else {
+        round_up = 0;
+        if( vp / 100 > vm / 100 ) {
+            round_up = ( vr % 100 >= 50 );
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while( vp / 10 > vm / 10 ) {
+            round_up = ( vr % 10 >= 5 );
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        output = vr + ( vr == vm || round_up );
+    }
+    e10 += removed;
+
+    for( len = 1, vr = output; vr >= 10; ++len ) {
+        vr /= 10;
+    }
+    for( i = len; i-- > 0; ) {
+        digits[i] = (char)( '0' + output % 10 );
+        output /= 10;
+    }
+    *xexp = e10 + len - 1;
+    return( len );
+}
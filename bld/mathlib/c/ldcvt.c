@@ -503,6 +503,44 @@ static void DoEFormat( CVT_INFO *cvt, char *p, int nsig, int xexp, char *buf )
 #define STK_BUF_SIZE    64              // size of stack buffer required
                                         // if long double and NO_TRUNC is on.
 
+/* number of significant digits wanted when the first is at 10^xexp */
+static int SigDigits( CVT_INFO *cvt, int xexp )
+{
+    int         nsig;
+
+    nsig = cvt->ndigits;
+    if( cvt->flags & F_FMT ) {
+        nsig += xexp + cvt->scale + 1;
+    } else if( cvt->flags & E_FMT ) {
+        if( cvt->scale > 0 ) {
+            ++nsig;
+        } else {
+            nsig += cvt->scale;
+        }
+    }
+    return( nsig );
+}
+
+#ifdef __FAST_DBLCVT__
+/*
+ * Rounding the shortest round-trip digits of a double gives the same
+ * result as rounding its exact value, except where they are too short
+ * (the zeros padding them out are only right for up to DBL_DIG digits,
+ * and not at all for denormals) or where all that is dropped is a final
+ * 5, which may stand for a little more or a little less than half.
+ */
+static int ShortDigitsOK( CVT_INFO *cvt, const char *p, int n, int xexp )
+{
+    int         nsig;
+
+    nsig = SigDigits( cvt, xexp );
+    if( nsig >= n ) {
+        return( nsig <= DBL_DIG && xexp >= DBL_MIN_10_EXP );
+    }
+    return( nsig != n - 1 || p[nsig] != '5' );
+}
+#endif
+
 /* NB: Just like _EFG_Format(), the following assumes ASCII character  encoding */
 
 _WMRTLINK void __LDcvt( long_double *pld, CVT_INFO *cvt, char *buf )
@@ -567,6 +605,23 @@ nan_inf:
         cvt->n1 = 3;
         goto end_cvt;
     case __NONZERO:
+#ifdef __FAST_DBLCVT__
+        if( (cvt->flags & LONG_DOUBLE) == 0 ) {
+            double      x;
+
+#ifdef _LONG_DOUBLE_
+            __iLDFD( &ld, &x );
+#else
+            x = ld.value;
+#endif
+            p = &stkbuf[1];
+            n = __DblShortest( x, p, &xexp );
+            if( ShortDigitsOK( cvt, p, n, xexp ) ) {
+                stkbuf[0] = '0';
+                goto round_digits;
+            }
+        }
+#endif
         // what if number is denormal?  should normalize it
 /*
     Estimate the position of the decimal point by estimating 1 + log10(x).
@@ -691,16 +746,13 @@ nan_inf:
         --xexp;
         ++p;
     }
-    nsig = cvt->ndigits;
+#ifdef __FAST_DBLCVT__
+round_digits:
+#endif
+    nsig = SigDigits( cvt, xexp );
     if( cvt->flags & F_FMT ) {
         xexp += cvt->scale;
-        nsig += xexp + 1;
     } else if( cvt->flags & E_FMT ) {
-        if( cvt->scale > 0 ) {
-            ++nsig;
-        } else {
-            nsig += cvt->scale;
-        }
         xexp = xexp + 1 - cvt->scale;
     }
     if( nsig >= 0 ) {           // round and strip trailing zeros
@@ -53,7 +53,8 @@ typedef enum {
     HEX_FOUND         = 0x10,
     NAN_FOUND         = 0x20,
     INFINITY_FOUND    = 0x40,
-    INVALID_SEQ       = 0x80
+    INVALID_SEQ       = 0x80,
+    DIGITS_DROPPED    = 0x100   /* nonzero digits beyond maxdigits */
 } flt_flags;
 
 enum {
@@ -63,6 +64,7 @@ enum {
     _NONZERO,
     _UNDERFLOW,
     _OVERFLOW,
+    _DOUBLE,                    /* already converted, see strtod() */
     _NEGATIVE   = 0x80
 };
 
@@ -255,6 +257,7 @@ static flt_flags parse_decimal( const CHAR_TYPE *input, CHAR_TYPE *buffer,
     int                 exponent  = 0;
     CHAR_TYPE           digitflag = '0';
     const CHAR_TYPE     *s = input;
+    int                 i;
 
     /* Parse the mantissa */
     for( ;; ) {
@@ -313,6 +316,15 @@ static flt_flags parse_decimal( const CHAR_TYPE *input, CHAR_TYPE *buffer,
         exponent -= fdigits;
 
         if( sigdigits > maxdigits ) {
+            if( sigdigits > MAX_SIG_DIG ) {
+                flags |= DIGITS_DROPPED;
+            } else {
+                for( i = maxdigits; i < sigdigits; ++i ) {
+                    if( buffer[ i ] != '0' ) {
+                        flags |= DIGITS_DROPPED;
+                    }
+                }
+            }
             exponent += sigdigits - maxdigits;
             sigdigits = maxdigits;
         }
@@ -426,12 +438,41 @@ static flt_flags parse_hex( const CHAR_TYPE *input, CHAR_TYPE *buffer,
 }
 
 
-/* Note: The only external user of __Strtold() is currently the CFE */
+#ifdef __FAST_DBLCVT__
 
-_WMRTLINK int __F_NAME(__Strtold,__wStrtold)( const CHAR_TYPE *bufptr,
-                                              long_double *pld,
-                                              CHAR_TYPE **endptr )
-/********************************************************************/
+/* Convert the digits straight to a double if that can be done exactly;
+ * when digits were dropped the number lies between w and w + 1 units,
+ * and if both of them round the same way that is the answer.
+ */
+static int dec_to_double( const CHAR_TYPE *buffer, int sigdigits,
+                          int exponent, flt_flags flags, double *pd )
+{
+    unsigned long long  w;
+    double              up;
+    int                 i;
+
+    w = 0;
+    for( i = 0; i < sigdigits; i++ ) {
+        w = w * 10 + ( buffer[ i ] - '0' );
+    }
+    if( !__DblFromDec( w, exponent, pd ) )
+        return( 0 );
+    if( flags & DIGITS_DROPPED ) {
+        if( !__DblFromDec( w + 1, exponent, &up ) || up != *pd ) {
+            return( 0 );
+        }
+    }
+    return( 1 );
+}
+
+#endif
+
+/* Parse a number into *pld. If pd isn't NULL, a decimal number may
+ * instead be converted straight to a double in *pd, leaving its sign
+ * to the caller, and the result is then _DOUBLE.
+ */
+static int parse_float( const CHAR_TYPE *bufptr, long_double *pld,
+                        CHAR_TYPE **endptr, double *pd )
 {
     int                 sigdigits;
     int                 exponent;
@@ -501,6 +542,15 @@ _WMRTLINK int __F_NAME(__Strtold,__wStrtold)( const CHAR_TYPE *bufptr,
 #endif
         return( _ZERO | neg );      /* indicate zero */
     } else {
+#ifdef __FAST_DBLCVT__
+        if( pd != NULL && (flags & HEX_FOUND) == 0 ) {
+            if( dec_to_double( buffer, sigdigits, exponent, flags, pd ) ) {
+                return( _DOUBLE | neg );
+            }
+        }
+#else
+        pd = pd;
+#endif
 #ifdef __WIDECHAR__
         char    tmp[ MAX_SIG_DIG + 1 ];
 #endif
@@ -550,6 +600,17 @@ _WMRTLINK int __F_NAME(__Strtold,__wStrtold)( const CHAR_TYPE *bufptr,
 }
 
 
+/* Note: The only external user of __Strtold() is currently the CFE */
+
+_WMRTLINK int __F_NAME(__Strtold,__wStrtold)( const CHAR_TYPE *bufptr,
+                                              long_double *pld,
+                                              CHAR_TYPE **endptr )
+/********************************************************************/
+{
+    return( parse_float( bufptr, pld, endptr, NULL ) );
+}
+
+
 _WMRTLINK double __F_NAME(strtod,wcstod)( const CHAR_TYPE *bufptr, CHAR_TYPE **endptr )
 /*************************************************************************************/
 {
@@ -557,9 +618,24 @@ _WMRTLINK double __F_NAME(strtod,wcstod)( const CHAR_TYPE *bufptr, CHAR_TYPE **e
     double      x;
     long_double ld;
 
-    rc = __F_NAME(__Strtold,__wStrtold)( bufptr, &ld, endptr );
+    rc = parse_float( bufptr, &ld, endptr, &x );
     type = rc & ~_NEGATIVE;
-    if( type == _ZERO || type == _ISNAN || type == _ISINF ) {
+    if( type == _DOUBLE ) {
+        union {
+            double          value;      // - double value
+            unsigned long   word[2];    // - so we can access bits
+        } d;
+
+        // as below, overflow and denormal or zero results are range errors
+        d.value = x;
+        if( (d.word[I64HI32] & 0x7FF00000) == 0
+          || (d.word[I64HI32] & 0x7FF00000) == 0x7FF00000 ) {
+            __set_ERANGE();
+        }
+        if( rc & _NEGATIVE ) {
+            x = -x;
+        }
+    } else if( type == _ZERO || type == _ISNAN || type == _ISINF ) {
         if( type == _ZERO )
             x = 0.0;
         else if( type == _ISNAN )
@@ -0,0 +1,46 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Powers of five for binary/decimal double conversion.
+*
+****************************************************************************/
+
+
+#ifndef _POW5TAB_H_INCLUDED
+#define _POW5TAB_H_INCLUDED
+
+/*
+ * __Pow5Tab128[q - POW5_TAB_MIN] holds 5^q scaled by a power of two so
+ * that the top bit of the 128-bit value is set, high half first. The
+ * values are truncated for q >= 0 and for q < -27, and rounded up for
+ * -27 <= q < 0, exactly as in the tables of the Eisel-Lemire algorithm.
+ */
+#define POW5_TAB_MIN    (-342)
+#define POW5_TAB_MAX    325
+
+extern const unsigned long long __Pow5Tab128[POW5_TAB_MAX - POW5_TAB_MIN + 1][2];
+
+#endif
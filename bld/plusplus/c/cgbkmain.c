@@ -64,6 +64,7 @@
 #include "floatsup.h"
 #include "rtti.h"
 #include "cgdllcli.h"
+#include "cmptime.h"
 
 #ifndef NDEBUG
 #include "pragdefn.h"
@@ -3213,7 +3214,9 @@ static void writeVirtualFile(   // EMIT AND FREE A VIRTUAL FILE
 {
     SYMBOL func;                // - function symbol
     FN_CTL* fctl;               // - file control
+    clock_t start;              // - time stamp at start
 
+    start = CompTimeStamp();
     ExtraRptIncrementCtr( ctr_funcs );
 //  new_ctor_ptr = NULL;
     autos = NULL;
@@ -3249,6 +3252,7 @@ static void writeVirtualFile(   // EMIT AND FREE A VIRTUAL FILE
     SymTransEmpty();
     AutoRelFree();
     CgBackFreeIndCalls();
+    CompTimeFunction( func, start );
 }
 
 
@@ -3336,7 +3340,9 @@ void CgBackEnd(                 // BACK-END CONTROLLER
     void )
 {
     cg_init_info cg_info;       // - information from code generator
+    comp_phase phase;           // - phase to restore
 
+    phase = CompTimePhase( CTP_BACK_END );
     CompFlags.codegen_active = TRUE;
     CDoptBackEnd();
     MarkFuncsToGen( max_inline_depth );
@@ -3412,6 +3418,7 @@ void CgBackEnd(                 // BACK-END CONTROLLER
             FreeSymbol( thisSym );
             FreeSymbol( cdtorSym );
         }
+        CompTimePhase( phase );
         BEDLLUnload();
     } else {
         CErr1( ERR_CODEGEN_CANT_INITIALIZE );
@@ -63,6 +63,7 @@
 #include "iosupp.h"
 #include "cppexit.h"
 #include "cgbackut.h"
+#include "cmptime.h"
 #include "cginmisc.h"
 #include "pragdefn.h"
 #include "specfuns.h"
@@ -189,6 +190,9 @@ void FEMessage(                 // MESSAGES FROM CODE-GENERATOR
     case MSG_NO_SEG_REGS:
         CErr2p( ERR_NO_SEG_REGS, FEName( (SYMBOL)parm ) );
         break;
+    case MSG_PHASE:
+        CompTimeCgPhase( (unsigned)parm );
+        break;
     }
 }
 
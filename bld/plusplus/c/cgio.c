@@ -52,6 +52,17 @@ static CGFILE *cg_file_removed; // ring of virtual files (removed)
 static carve_t carveCGFILE;
 static carve_t carveCGFILE_GEN;
 
+#define FILE_HASH_MIN   256     // initial # of hash buckets (power of 2)
+
+static struct {                 // index of CGFILEs, by symbol
+    CGFILE      **buckets;      // - hash buckets (chained thru hash_next)
+    unsigned    size;           // - # buckets
+    unsigned    count;          // - # files
+    unsigned    seq;            // - next ring sequence #
+} fileIndex;
+
+#define fileHash( sym ) ( (unsigned)( (unsigned long)(sym) >> 3 ) & ( fileIndex.size - 1 ) )
+
 ExtraRptCtr( cgio_write_ins );
 ExtraRptCtr( cgio_write_nul );
 ExtraRptCtr( cgio_files );
@@ -134,6 +145,61 @@ ExtraRptCtr( cgio_locates_thunk );
 #endif
 
 
+static void fileIndexFree(      // FREE THE INDEX OF FILES
+    void )
+{
+    CMemFreePtr( &fileIndex.buckets );
+    fileIndex.size = 0;
+    fileIndex.count = 0;
+    fileIndex.seq = 0;
+}
+
+
+static void fileIndexGrow(      // DOUBLE THE # OF HASH BUCKETS
+    void )
+{
+    CGFILE **old_buckets;       // - old buckets
+    unsigned old_size;          // - old # buckets
+    CGFILE *curr;               // - current file
+    CGFILE *next;               // - next file in old chain
+    CGFILE **head;              // - new chain
+    unsigned i;                 // - bucket index
+
+    old_buckets = fileIndex.buckets;
+    old_size = fileIndex.size;
+    fileIndex.size = ( old_size == 0 ) ? FILE_HASH_MIN : old_size * 2;
+    fileIndex.buckets = CMemAlloc( fileIndex.size * sizeof( CGFILE * ) );
+    memset( fileIndex.buckets, 0, fileIndex.size * sizeof( CGFILE * ) );
+    for( i = 0; i < old_size; ++i ) {
+        for( curr = old_buckets[i]; curr != NULL; curr = next ) {
+            next = curr->hash_next;
+            head = &fileIndex.buckets[ fileHash( curr->symbol ) ];
+            curr->hash_next = *head;
+            *head = curr;
+        }
+    }
+    CMemFree( old_buckets );
+}
+
+
+static void fileIndexAdd(       // ADD FILE TO INDEX, NOTE ITS RING
+    CGFILE *ctl,                // - control for file
+    CGFILE **a_ring )           // - addr[ ring header ]
+{
+    CGFILE **head;              // - hash chain
+
+    if( fileIndex.count >= fileIndex.size ) {
+        fileIndexGrow();
+    }
+    ++fileIndex.count;
+    head = &fileIndex.buckets[ fileHash( ctl->symbol ) ];
+    ctl->hash_next = *head;
+    *head = ctl;
+    ctl->ring = a_ring;
+    ctl->ring_seq = fileIndex.seq++;
+}
+
+
 static void cgioInit(           // INITIALIZE FOR CG-IO
     INITFINI* defn )
 {
@@ -141,6 +207,7 @@ static void cgioInit(           // INITIALIZE FOR CG-IO
     cg_file_ring = NULL;
     cg_thunk_ring = NULL;
     cg_file_removed = NULL;
+    memset( &fileIndex, 0, sizeof( fileIndex ) );
     CgioBuffInit();
     carveCGFILE = CarveCreate( sizeof( CGFILE ), 64 );
     carveCGFILE_GEN = CarveCreate( sizeof( CGFILE_GEN ), 32 );
@@ -177,6 +244,7 @@ static void cgioFini(           // FINALIZE FOR CG-IO
     INITFINI* defn )
 {
     defn = defn;
+    fileIndexFree();
     CgioBuffFini();
     CarveDestroy( carveCGFILE );
     CarveDestroy( carveCGFILE_GEN );
@@ -188,17 +256,26 @@ INITDEFN( cgio, cgioInit, cgioFini )
 
 static CGFILE* lookupFile(      // DO A FILE LOOKUP FOR A SYMBOL, RING
     SYMBOL sym,                 // - symbol
-    CGFILE* ring )              // - ring of symbols
+    CGFILE** a_ring )           // - addr[ ring of symbols ]
 {
     CGFILE *curr;               // - current CGFILE
-
-    RingIterBeg( ring, curr ) {
-        ExtraRptIncrementCtr( cgio_comps );
-        if( sym == curr->symbol ) {
-            return curr;
+    CGFILE *retn;               // - first such CGFILE in the ring
+
+    retn = NULL;
+    if( fileIndex.size != 0 ) {
+        curr = fileIndex.buckets[ fileHash( sym ) ];
+        for( ; curr != NULL; curr = curr->hash_next ) {
+            ExtraRptIncrementCtr( cgio_comps );
+            if( sym == curr->symbol
+             && a_ring == curr->ring ) {
+                if( retn == NULL
+                 || curr->ring_seq < retn->ring_seq ) {
+                    retn = curr;
+                }
+            }
         }
-    } RingIterEnd( curr );
-    return NULL;
+    }
+    return retn;
 }
 
 #ifndef NDEBUG
@@ -283,7 +360,9 @@ CGFILE *CgioCreateFile(         // CREATE A CG VIRTUAL FILE
 
     ExtraRptIncrementCtr( cgio_files );
     new_cgfile = RingCarveAlloc( carveCGFILE, &cg_file_ring );
-    return( initCGFILE( new_cgfile, symbol ) );
+    initCGFILE( new_cgfile, symbol );
+    fileIndexAdd( new_cgfile, &cg_file_ring );
+    return( new_cgfile );
 }
 
 
@@ -414,6 +493,8 @@ static boolean changeRing(      // CHANGE RING FOR A CGFILE IN cg_file_ring
     } else {
         RingPruneWithPrev( a_old, element, prev );
         RingAppend( a_new, element );
+        element->ring = a_new;
+        element->ring_seq = fileIndex.seq++;
         retn = TRUE;
     }
     return retn;
@@ -474,7 +555,7 @@ void CgioThunkAddrTaken(        // INDICATE ADDR TAKEN OF THUNK BY GEN'ED CODE
     ExtraRptIncrementCtr( cgio_locates_thunk );
     thunk_file = CgioLocateFile( thunk );
     if( thunk_file == NULL ) {
-        thunk_file = lookupFile( thunk, cg_thunk_ring );
+        thunk_file = lookupFile( thunk, &cg_thunk_ring );
     }
     if( thunk_file != NULL
      && thunk_file->s.thunk ) {
@@ -509,7 +590,7 @@ CGFILE *CgioLocateFile(         // LOCATE LIVE FILE FOR A SYMBOL
     SYMBOL sym )                // - symbol for file
 {
     ExtraRptIncrementCtr( cgio_locates );
-    return lookupFile( sym, cg_file_ring );
+    return lookupFile( sym, &cg_file_ring );
 }
 
 
@@ -520,9 +601,9 @@ CGFILE* CgioLocateAnyFile(      // LOCATE LIVE OR REMOVED FILE FOR A SYMBOL
 
     retn = CgioLocateFile( sym );
     if( retn == NULL ) {
-        retn = lookupFile( sym, cg_thunk_ring );
+        retn = lookupFile( sym, &cg_thunk_ring );
         if( retn == NULL ) {
-            retn = lookupFile( sym, cg_file_removed );
+            retn = lookupFile( sym, &cg_file_removed );
         }
     }
     return retn;
@@ -740,6 +821,7 @@ pch_status PCHReadCGFiles( void )
         RingAppend( &cg_file_ring, curr );
         sym = SymbolMapIndex( PCHReadPtr() );
         initCGFILE( curr, sym );
+        fileIndexAdd( curr, &cg_file_ring );
         curr->opt_retn = SymbolMapIndex( PCHReadPtr() );
         curr->flags = PCHReadUInt();
         for(;;) {
@@ -796,6 +878,7 @@ pch_status PCHInitCGFiles( boolean writing )
             }
         } RingIterEnd( curr )
         cg_file_ring = NULL;
+        fileIndexFree();
         carveCGFILE = CarveRestart( carveCGFILE );
         n = PCHReadCVIndex();
         CarveMapOptimize( carveCGFILE, n );
@@ -43,6 +43,7 @@
 #include "name.h"
 #include "cmacsupp.h"
 #include "brinfo.h"
+#include "cmptime.h"
 
 
 typedef struct mac_parm MAC_PARM;
@@ -720,7 +721,9 @@ static void preProcStmt( void )
 {
     PPCTRL      *pp;
     int         hash;
+    comp_phase  phase;
 
+    phase = CompTimePhase( CTP_PREPROC );
     NextChar();
     NextToken();
     if( CurToken == T_ID ) {
@@ -740,6 +743,7 @@ static void preProcStmt( void )
         CUnknown();
     }
     flush2EOL();
+    CompTimePhase( phase );
 }
 
 // When a new file is opened, it's guarded state will indicate top of file.
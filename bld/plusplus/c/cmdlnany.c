@@ -56,6 +56,7 @@
 #include "pdefn2.h"
 #include "initdefs.h"
 #include "brinfo.h"
+#include "cmptime.h"
 
 #include "cmdlnpr1.gh"
 #include "cmdlnsys.h"
@@ -1153,6 +1154,15 @@ static void analyseAnyTargetOptions( OPT_STORAGE *data )
     if( data->fr ) {
         SetStringOption( &ErrorFileName, &(data->fr_value) );
     }
+    if( data->ftr ) {
+        CompFlags.time_report = 1;
+        CompTimeSetFileName( SetStringOption( NULL, &(data->ftr_value) ) );
+    }
+    if( data->ftrj ) {
+        CompFlags.time_report = 1;
+        CompFlags.time_report_json = 1;
+        CompTimeSetFileName( SetStringOption( NULL, &(data->ftrj_value) ) );
+    }
     if( data->i ) {
         OPT_STRING *s;
         reverseList( &(data->i_value) );
@@ -756,6 +756,9 @@ static void macroDefs( void )
     if( TargetSwitches & GEN_FWAIT_386 ) {
         DefSwitchMacro( "ZFW" );
     }
+    if( TargetSwitches & SSE2_CONVERT ) {
+        DefSwitchMacro( "FPS" );
+    }
     if( CompFlags.signed_char ) {
         DefSwitchMacro( "J" );
     }
@@ -989,6 +992,11 @@ void CmdSysAnalyse( OPT_STORAGE *data )
     if( data->zfw ) {
         TargetSwitches |= GEN_FWAIT_386;
     }
+#if _CPU == 386
+    if( data->fps ) {
+        TargetSwitches |= SSE2_CONVERT;
+    }
+#endif
 #if _CPU == 386
     if( data->zro && data->zri ) {
 //        DbgDefault( "invalid fp rounding flags - ignored" );
@@ -0,0 +1,480 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Compile-time and memory report by compiler phase.
+*
+****************************************************************************/
+
+
+
+#include "plusplus.h"
+
+#include <stdio.h>
+
+#include "errdefns.h"
+#include "preproc.h"
+#include "memmgr.h"
+#include "codegen.h"
+#include "fmtsym.h"
+#include "vbuf.h"
+#include "cmptime.h"
+#include "initdefs.h"
+
+#define TOP_FUNCS       10      // # of most expensive functions reported
+
+typedef struct                  // TIME_PHASE -- accumulation for a phase
+{   clock_t time;               // - time spent in phase
+    unsigned long memory;       // - memory acquired in phase
+    unsigned entries;           // - # of times phase was entered
+} TIME_PHASE;
+
+typedef struct                  // TIME_FUNC -- an expensive function
+{   char *name;                 // - function name
+    clock_t time;               // - time spent generating it
+} TIME_FUNC;
+
+static const char *phaseNames[] = {   // PHASE NAMES
+    "parse",
+    "preprocess",
+    "template instantiation",
+    "back end",
+    "cg optimize",
+    "cg loop optimize",
+    "cg register allocation",
+    "cg instruction scheduling",
+    "cg encode",
+    "cg object write",
+};
+
+static TIME_PHASE phases[ CTP_MAX ];    // accumulation by phase
+static TIME_FUNC topFuncs[ TOP_FUNCS ]; // most expensive functions
+static comp_phase fePhase;      // current front-end phase
+static comp_phase cgPhase;      // current cg phase (CTP_MAX ==> none)
+static clock_t lastTime;        // time at last phase change
+static clock_t startTime;       // time at start of file
+static unsigned long lastMem;   // memory in use at last phase change
+static unsigned long peakMem;   // peak memory in use
+static char *reportFile;        // report file name (NULL ==> stdout)
+
+
+static comp_phase currPhase(    // GET PHASE BEING CHARGED
+    void )
+{
+    if( cgPhase != CTP_MAX ) {
+        return( cgPhase );
+    }
+    return( fePhase );
+}
+
+
+static void chargePhase(        // CHARGE TIME, MEMORY TO CURRENT PHASE
+    void )
+{
+    TIME_PHASE *ph;             // - current phase
+    clock_t now;                // - current time
+    unsigned long mem;          // - memory in use
+
+    ph = &phases[ currPhase() ];
+    now = clock();
+    ph->time += now - lastTime;
+    lastTime = now;
+    mem = BEMemInUse();
+    if( mem > lastMem ) {
+        ph->memory += mem - lastMem;
+    }
+    lastMem = mem;
+    if( mem > peakMem ) {
+        peakMem = mem;
+    }
+}
+
+
+static void enterPhase(         // ENTER A PHASE
+    comp_phase phase )          // - phase entered
+{
+    ++phases[ phase ].entries;
+}
+
+
+comp_phase CompTimePhase(       // SET FRONT-END PHASE
+    comp_phase phase )          // - new phase
+{
+    comp_phase old;             // - previous phase
+
+    old = fePhase;
+    if( CompFlags.time_report && phase != old ) {
+        chargePhase();
+        fePhase = phase;
+        if( cgPhase == CTP_MAX ) {
+            enterPhase( phase );
+        }
+    }
+    return( old );
+}
+
+
+void CompTimeCgPhase(           // SET PHASE REPORTED BY CODE GENERATOR
+    int phase )                 // - code generator phase
+{
+    comp_phase new_phase;       // - new cg phase
+
+    if( ! CompFlags.time_report ) {
+        return;
+    }
+    switch( phase ) {
+    case PHASE_OPTIMIZE :
+        new_phase = CTP_CG_OPTIMIZE;
+        break;
+    case PHASE_LOOP_OPT :
+        new_phase = CTP_CG_LOOP_OPT;
+        break;
+    case PHASE_REG_ALLOC :
+        new_phase = CTP_CG_REG_ALLOC;
+        break;
+    case PHASE_SCHEDULE :
+        new_phase = CTP_CG_SCHEDULE;
+        break;
+    case PHASE_ENCODE :
+        new_phase = CTP_CG_ENCODE;
+        break;
+    case PHASE_OBJECT :
+        new_phase = CTP_CG_OBJECT;
+        break;
+    default :
+        new_phase = CTP_MAX;
+        break;
+    }
+    if( new_phase != cgPhase ) {
+        chargePhase();
+        cgPhase = new_phase;
+        enterPhase( currPhase() );
+    }
+}
+
+
+clock_t CompTimeStamp(          // GET TIME STAMP FOR FUNCTION TIMING
+    void )
+{
+    if( ! CompFlags.time_report ) {
+        return( 0 );
+    }
+    return( clock() );
+}
+
+
+void CompTimeFunction(          // RECORD TIME SPENT ON A FUNCTION
+    SYMBOL func,                // - function (NULL ==> module data)
+    clock_t start )             // - time stamp at start
+{
+    clock_t time;               // - time for function
+    TIME_FUNC *tf;              // - entry replaced
+    unsigned i;                 // - index
+    VBUF name;                  // - function name
+
+    if( ! CompFlags.time_report ) {
+        return;
+    }
+    time = clock() - start;
+    tf = &topFuncs[ TOP_FUNCS - 1 ];
+    if( time <= tf->time ) {
+        return;
+    }
+    CMemFree( tf->name );
+    for( i = TOP_FUNCS - 1; i > 0; --i ) {
+        if( topFuncs[ i - 1 ].time >= time ) break;
+        topFuncs[ i ] = topFuncs[ i - 1 ];
+    }
+    tf = &topFuncs[ i ];
+    VbufInit( &name );
+    if( func == NULL ) {
+        VbufConcStr( &name, "<module data>" );
+    } else {
+        FormatSym( func, &name );
+    }
+    tf->name = strcpy( CMemAlloc( VbufLen( &name ) + 1 ), VbufString( &name ) );
+    tf->time = time;
+    VbufFree( &name );
+}
+
+
+void CompTimeSetFileName(       // SET REPORT FILE NAME
+    char *name )                // - name (NULL ==> standard output)
+{
+    CMemFree( reportFile );
+    reportFile = name;
+}
+
+
+static void resetTimes(         // RESET ACCUMULATED TIMES
+    void )
+{
+    unsigned i;                 // - index
+
+    for( i = 0; i < TOP_FUNCS; ++i ) {
+        CMemFree( topFuncs[ i ].name );
+    }
+    memset( topFuncs, 0, sizeof( topFuncs ) );
+    memset( phases, 0, sizeof( phases ) );
+    fePhase = CTP_PARSE;
+    cgPhase = CTP_MAX;
+}
+
+
+void CompTimeStart(             // START TIMING A SOURCE FILE
+    void )
+{
+    resetTimes();
+    if( CompFlags.time_report ) {
+        startTime = clock();
+        lastTime = startTime;
+        lastMem = BEMemInUse();
+        peakMem = lastMem;
+        enterPhase( CTP_PARSE );
+    }
+}
+
+
+static void concSeconds(        // CONCATENATE TIME IN SECONDS
+    VBUF *buf,                  // - buffer
+    clock_t time )              // - time
+{
+    char sbuff[32];             // - formatting buffer
+
+    sprintf( sbuff, "%.3f", (double)time / CLOCKS_PER_SEC );
+    VbufConcStr( buf, sbuff );
+}
+
+
+static void concPadded(         // CONCATENATE, PADDED ON RIGHT
+    VBUF *buf,                  // - buffer
+    const char *str,            // - string
+    unsigned width )            // - minimum width
+{
+    size_t len;                 // - length of string
+
+    VbufConcStr( buf, str );
+    for( len = strlen( str ); len < width; ++len ) {
+        VbufConcChr( buf, ' ' );
+    }
+}
+
+
+static void concJsonStr(        // CONCATENATE A JSON STRING
+    VBUF *buf,                  // - buffer
+    const char *str )           // - string
+{
+    char sbuff[8];              // - formatting buffer
+
+    VbufConcChr( buf, '"' );
+    for( ; *str != '\0'; ++str ) {
+        if( *str == '"' || *str == '\\' ) {
+            VbufConcChr( buf, '\\' );
+            VbufConcChr( buf, *str );
+        } else if( (unsigned char)*str < ' ' ) {
+            sprintf( sbuff, "\\u%04x", (unsigned char)*str );
+            VbufConcStr( buf, sbuff );
+        } else {
+            VbufConcChr( buf, *str );
+        }
+    }
+    VbufConcChr( buf, '"' );
+}
+
+
+static void reportLine(         // WRITE A REPORT LINE
+    FILE *fp,                   // - report file (NULL ==> stdout)
+    VBUF *buf )                 // - line
+{
+    if( fp == NULL ) {
+        MsgDisplayLine( VbufString( buf ) );
+    } else {
+        fputs( VbufString( buf ), fp );
+        fputc( '\n', fp );
+    }
+    VbufRewind( buf );
+}
+
+
+static void reportText(         // PRODUCE TEXT REPORT
+    FILE *fp,                   // - report file (NULL ==> stdout)
+    clock_t total )             // - total time
+{
+    VBUF buf;                   // - line buffer
+    unsigned i;                 // - index
+
+    VbufInit( &buf );
+    VbufConcStr( &buf, "Compile time report: " );
+    VbufConcStr( &buf, WholeFName );
+    reportLine( fp, &buf );
+    reportLine( fp, &buf );
+    VbufConcStr( &buf, "Phase                       Seconds  Entries  Memory(KB)" );
+    reportLine( fp, &buf );
+    for( i = 0; i < CTP_MAX; ++i ) {
+        if( phases[ i ].entries == 0 ) continue;
+        concPadded( &buf, phaseNames[ i ], 26 );
+        VbufConcStr( &buf, " " );
+        concSeconds( &buf, phases[ i ].time );
+        VbufConcStr( &buf, " " );
+        VbufConcDecimal( &buf, phases[ i ].entries );
+        VbufConcStr( &buf, " " );
+        VbufConcDecimal( &buf, ( phases[ i ].memory + 1023 ) / 1024 );
+        reportLine( fp, &buf );
+    }
+    VbufConcStr( &buf, "total seconds: " );
+    concSeconds( &buf, total );
+    VbufConcStr( &buf, ", peak memory (KB): " );
+    VbufConcDecimal( &buf, ( peakMem + 1023 ) / 1024 );
+    reportLine( fp, &buf );
+    if( topFuncs[ 0 ].name != NULL ) {
+        reportLine( fp, &buf );
+        VbufConcStr( &buf, "Most expensive functions:" );
+        reportLine( fp, &buf );
+        for( i = 0; i < TOP_FUNCS; ++i ) {
+            if( topFuncs[ i ].name == NULL ) break;
+            VbufConcStr( &buf, "  " );
+            concSeconds( &buf, topFuncs[ i ].time );
+            VbufConcStr( &buf, "  " );
+            VbufConcStr( &buf, topFuncs[ i ].name );
+            reportLine( fp, &buf );
+        }
+    }
+    VbufFree( &buf );
+}
+
+
+static void reportJson(         // PRODUCE JSON REPORT
+    FILE *fp,                   // - report file (NULL ==> stdout)
+    clock_t total )             // - total time
+{
+    VBUF buf;                   // - line buffer
+    unsigned i;                 // - index
+    const char *sep;            // - separator
+
+    VbufInit( &buf );
+    VbufConcStr( &buf, "{ \"file\": " );
+    concJsonStr( &buf, WholeFName );
+    VbufConcStr( &buf, "," );
+    reportLine( fp, &buf );
+    VbufConcStr( &buf, "  \"total_seconds\": " );
+    concSeconds( &buf, total );
+    VbufConcStr( &buf, "," );
+    reportLine( fp, &buf );
+    VbufConcStr( &buf, "  \"peak_memory_kb\": " );
+    VbufConcDecimal( &buf, ( peakMem + 1023 ) / 1024 );
+    VbufConcStr( &buf, "," );
+    reportLine( fp, &buf );
+    VbufConcStr( &buf, "  \"phases\": [" );
+    reportLine( fp, &buf );
+    sep = "    ";
+    for( i = 0; i < CTP_MAX; ++i ) {
+        if( phases[ i ].entries == 0 ) continue;
+        VbufConcStr( &buf, sep );
+        VbufConcStr( &buf, "{ \"name\": " );
+        concJsonStr( &buf, phaseNames[ i ] );
+        VbufConcStr( &buf, ", \"seconds\": " );
+        concSeconds( &buf, phases[ i ].time );
+        VbufConcStr( &buf, ", \"entries\": " );
+        VbufConcDecimal( &buf, phases[ i ].entries );
+        VbufConcStr( &buf, ", \"memory_kb\": " );
+        VbufConcDecimal( &buf, ( phases[ i ].memory + 1023 ) / 1024 );
+        VbufConcStr( &buf, " }" );
+        reportLine( fp, &buf );
+        sep = "  , ";
+    }
+    VbufConcStr( &buf, "  ]," );
+    reportLine( fp, &buf );
+    VbufConcStr( &buf, "  \"functions\": [" );
+    reportLine( fp, &buf );
+    sep = "    ";
+    for( i = 0; i < TOP_FUNCS; ++i ) {
+        if( topFuncs[ i ].name == NULL ) break;
+        VbufConcStr( &buf, sep );
+        VbufConcStr( &buf, "{ \"name\": " );
+        concJsonStr( &buf, topFuncs[ i ].name );
+        VbufConcStr( &buf, ", \"seconds\": " );
+        concSeconds( &buf, topFuncs[ i ].time );
+        VbufConcStr( &buf, " }" );
+        reportLine( fp, &buf );
+        sep = "  , ";
+    }
+    VbufConcStr( &buf, "  ]" );
+    reportLine( fp, &buf );
+    VbufConcStr( &buf, "}" );
+    reportLine( fp, &buf );
+    VbufFree( &buf );
+}
+
+
+void CompTimeReport(            // PRODUCE THE REPORT
+    void )
+{
+    FILE *fp;                   // - report file
+
+    if( ! CompFlags.time_report ) {
+        return;
+    }
+    chargePhase();
+    fp = NULL;
+    if( reportFile != NULL ) {
+        fp = fopen( reportFile, "w" );
+        if( fp == NULL ) {
+            CErr2p( ERR_CANT_OPEN_FILE, reportFile );
+            return;
+        }
+    }
+    if( CompFlags.time_report_json ) {
+        reportJson( fp, lastTime - startTime );
+    } else {
+        reportText( fp, lastTime - startTime );
+    }
+    if( fp != NULL ) {
+        fclose( fp );
+    }
+}
+
+
+static void compTimeInit(       // INITIALIZATION
+    INITFINI* defn )            // - definition
+{
+    defn = defn;
+    reportFile = NULL;
+    memset( topFuncs, 0, sizeof( topFuncs ) );
+    memset( phases, 0, sizeof( phases ) );
+    fePhase = CTP_PARSE;
+    cgPhase = CTP_MAX;
+}
+
+
+static void compTimeFini(       // COMPLETION
+    INITFINI* defn )            // - definition
+{
+    defn = defn;
+    resetTimes();
+    CMemFreePtr( &reportFile );
+}
+
+
+INITDEFN( comp_time, compTimeInit, compTimeFini )
@@ -62,6 +62,7 @@
 #include "autodep.h"
 #include "swchar.h"
 #include "ialias.h"
+#include "cmptime.h"
 
 #ifndef NDEBUG
 #include <stdio.h>
@@ -330,6 +331,7 @@ static int doCCompile(          // COMPILE C++ PROGRAM
                 ExitPointAcquire( cpp_preproc );
                 ExitPointAcquire( cpp_object );
                 ExitPointAcquire( cpp_analysis );
+                CompTimeStart();
                 CgFrontModInitInit();       // must be before pchdr read point
                 CompFlags.watch_for_pcheader = FALSE;
                 CompFlags.ignore_fnf = TRUE;
@@ -386,6 +388,7 @@ static int doCCompile(          // COMPILE C++ PROGRAM
                 }
                 else
                     AdClose( TRUE );
+                CompTimeReport();
                 CtxSetContext( CTX_FINI );
                 ExitPointRelease( cpp_object );
             }
@@ -47,6 +47,8 @@
 #include "pcheader.h"
 #include "initdefs.h"
 #include "conpool.h"
+#include "stats.h"
+#include "cmptime.h"
 #ifndef NDEBUG
 #include "pragdefn.h"
 #include "dbg.h"
@@ -58,10 +60,12 @@
 #define BLOCK_CLASS_INST        32
 #define BLOCK_TEMPLATE_MEMBER   32
 #define BLOCK_FN_TEMPLATE       16
+#define BLOCK_INST_ENTRY        64
 static carve_t carveTEMPLATE_INFO;
 static carve_t carveCLASS_INST;
 static carve_t carveTEMPLATE_MEMBER;
 static carve_t carveFN_TEMPLATE;
+static carve_t carveINST_ENTRY;
 
 static TEMPLATE_DATA *currentTemplate;
 static TEMPLATE_INFO *allClassTemplates;
@@ -104,6 +108,7 @@ struct template_context {
         void                    *any;
     } u;
     enum template_context_type  id;
+    comp_phase                  phase;  // phase to restore on pop
 };
 
 static struct {
@@ -113,11 +118,40 @@ static struct {
 
 static SUICIDE_CALLBACK templateSuicide;
 
+// index of the existing instantiations of every template, keyed on a hash
+// of the bound template arguments; the rings stay the primary record
+
+#define INST_INDEX_MIN          256     // initial # buckets (power of 2)
+
+typedef struct inst_entry INST_ENTRY;
+struct inst_entry {                     // INSTANTIATION INDEX ENTRY
+    INST_ENTRY          *next;          // - next in bucket
+    void                *owner;         // - TEMPLATE_INFO, ..._SPECIALIZATION, FN_TEMPLATE
+    void                *inst;          // - UNBOUND_TEMPLATE, CLASS_INST, FN_TEMPLATE_INST
+    unsigned            hash;           // - hash of bound arguments
+};
+
+static struct {
+    INST_ENTRY          **buckets;      // - hash buckets
+    unsigned            size;           // - # buckets
+    unsigned            count;          // - # entries
+    unsigned            stale : 1;      // - rebuild before use (PCH read)
+} instIndex;
+
+ExtraRptCtr( ctr_inst_lookups );        // # instantiation lookups
+ExtraRptCtr( ctr_inst_probes );         // # entries compared
+ExtraRptCtr( ctr_inst_found );          // # lookups that found one
+ExtraRptCtr( ctr_inst_entries );        // # entries added
+ExtraRptCtr( ctr_inst_resizes );        // # times index was enlarged
+
 static void injectTemplateParm( SCOPE scope, PTREE parm, char *name );
 
 
 static void templateSuicideHandler( void )
 {
+    if( activeInstantiations.inst_stack != NULL ) {
+        CompTimePhase( CTP_PARSE );
+    }
     activeInstantiations.inst_stack = NULL;
     templateData.curr_depth = 0;
 }
@@ -152,12 +186,14 @@ static void pushInstContext( TEMPLATE_CONTEXT *ctx,
     ctx->id = id;
     ctx->locn = locn;
     ctx->u.any = extra_info;
+    ctx->phase = CompTimePhase( CTP_TEMPLATE );
     StackPush( &(activeInstantiations.inst_stack), ctx );
 }
 
 static void popInstContext( void )
 {
     templateData.curr_depth--;
+    CompTimePhase( activeInstantiations.inst_stack->phase );
     StackPop( &(activeInstantiations.inst_stack) );
 }
 
@@ -228,6 +264,292 @@ void TemplateSetDepth( unsigned depth )
     templateData.max_depth = depth;
 }
 
+#define hashMix( h, v )         ( ( (h) << 5 ) + (h) + (unsigned)(v) )
+#define hashPtr( p )            ( (unsigned)( (unsigned long)(p) >> 3 ) )
+
+static unsigned hashType( TYPE type )
+// hash a type so that types which TypeCompareExclude() considers the same
+// (with TC1_NULL or TC1_NOT_ENUM_CHAR) always get the same hash
+{
+    unsigned hash;
+    type_flag flag;
+    void *base;
+    char *name;
+
+    hash = 0;
+    for( ; type != NULL; type = type->of ) {
+        type = TypeModExtract( type, &flag, &base, TC1_NULL );
+        if( type == NULL ) break;
+        if( ( type->id == TYP_CLASS )
+         && ( type->flag & TF1_UNBOUND )
+         && ( type->of != NULL ) ) {
+            type = type->of;
+        }
+        hash = hashMix( hash, type->id );
+        switch( type->id ) {
+        case TYP_POINTER:
+            continue;
+        case TYP_ARRAY:
+            hash = hashMix( hash, type->u.a.array_size );
+            continue;
+        case TYP_CLASS:
+            // same class or same template (see TemplateUnboundSame)
+            hash = hashMix( hash, hashPtr( type->u.c.info->name ) );
+            break;
+        case TYP_FUNCTION:
+            if( type->u.f.args != NULL ) {
+                hash = hashMix( hash, type->u.f.args->num_args );
+            }
+            break;
+        case TYP_GENERIC:
+            hash = hashMix( hash, type->u.g.index );
+            break;
+        case TYP_TYPENAME:
+            for( name = type->u.n.name; *name != '\0'; ++name ) {
+                hash = hashMix( hash, *name );
+            }
+            break;
+        }
+        break;
+    }
+    return( hash );
+}
+
+static unsigned hashInt64( signed_64 *value )
+{
+    return( value->u._32[0] ^ value->u._32[1] );
+}
+
+static unsigned hashClassParm( SYMBOL temp_arg )
+// must agree with hashParmTree() whenever parmsDifferent() says "same"
+{
+    INT_CONSTANT con;
+    SYMBOL sym;
+
+    if( SymIsConstantInt( temp_arg ) ) {
+        SymConstantValue( temp_arg, &con );
+        return( hashMix( PT_INT_CONSTANT, hashInt64( &con.value ) ) );
+    } else if( SymIsTypedef( temp_arg ) ) {
+        return( hashMix( PT_TYPE, hashType( temp_arg->sym_type ) ) );
+    }
+    sym = SymAddressOf( temp_arg );
+    if( sym != NULL ) {
+        return( hashMix( PT_SYMBOL, hashPtr( sym ) ) );
+    }
+    return( 0 );
+}
+
+static unsigned hashParmTree( PTREE parm )
+{
+    switch( parm->op ) {
+    case PT_INT_CONSTANT:
+        return( hashMix( PT_INT_CONSTANT, hashInt64( &parm->u.int64_constant ) ) );
+    case PT_TYPE:
+        return( hashMix( PT_TYPE, hashType( parm->type ) ) );
+    case PT_SYMBOL:
+        return( hashMix( PT_SYMBOL, hashPtr( parm->u.symcg.symbol ) ) );
+    }
+    return( 0 );
+}
+
+static unsigned hashParmList( PTREE parms )
+// hash a list of class template arguments (see sameParms)
+{
+    unsigned hash;
+
+    hash = 0;
+    for( ; parms != NULL; parms = parms->u.subtree[0] ) {
+        hash = hashMix( hash, hashParmTree( parms->u.subtree[1] ) );
+    }
+    return( hash );
+}
+
+static unsigned hashParmScope( SCOPE parm_scope )
+// hash the bound arguments of a class template instantiation
+{
+    unsigned hash;
+    SYMBOL curr;
+    SYMBOL stop;
+
+    hash = 0;
+    curr = NULL;
+    stop = ScopeOrderedStart( parm_scope );
+    for(;;) {
+        curr = ScopeOrderedNext( stop, curr );
+        if( curr == NULL ) break;
+        hash = hashMix( hash, hashClassParm( curr ) );
+    }
+    return( hash );
+}
+
+static unsigned hashFnParmScope( SCOPE parm_scope )
+// hash the bound arguments of a function template instantiation (must
+// agree with the comparison in TemplateFunctionGenerate)
+{
+    unsigned hash;
+    SYMBOL curr;
+    SYMBOL stop;
+
+    hash = 0;
+    curr = NULL;
+    stop = ScopeOrderedStart( parm_scope );
+    for(;;) {
+        curr = ScopeOrderedNext( stop, curr );
+        if( curr == NULL ) break;
+        hash = hashMix( hash, curr->id );
+        switch( curr->id ) {
+        case SC_TYPEDEF:
+            hash = hashMix( hash, hashType( curr->sym_type ) );
+            break;
+        case SC_STATIC:
+            hash = hashMix( hash, curr->u.uval );
+            break;
+        case SC_ADDRESS_ALIAS:
+            hash = hashMix( hash, hashPtr( curr->u.alias ) );
+            break;
+        }
+    }
+    return( hash );
+}
+
+static SCOPE classInstParmScope( CLASS_INST *inst )
+{
+    SCOPE parm_scope;
+
+    parm_scope = inst->scope->enclosing;
+    if( ScopeType( parm_scope, SCOPE_TEMPLATE_SPEC_PARM ) ) {
+        parm_scope = parm_scope->enclosing;
+    }
+    return( parm_scope );
+}
+
+static INST_ENTRY **instBucket( void *owner, unsigned hash )
+{
+    return( &instIndex.buckets[ ( hash ^ hashPtr( owner ) ) & ( instIndex.size - 1 ) ] );
+}
+
+static void instIndexFree( void )
+{
+    CMemFreePtr( &instIndex.buckets );
+    CarveDestroy( carveINST_ENTRY );
+    carveINST_ENTRY = CarveCreate( sizeof( INST_ENTRY ), BLOCK_INST_ENTRY );
+    instIndex.size = 0;
+    instIndex.count = 0;
+}
+
+static void instIndexResize( unsigned size )
+{
+    INST_ENTRY **old_buckets;
+    unsigned old_size;
+    unsigned i;
+    INST_ENTRY *curr;
+    INST_ENTRY *next;
+    INST_ENTRY **head;
+
+    old_buckets = instIndex.buckets;
+    old_size = instIndex.size;
+    instIndex.buckets = CMemAlloc( size * sizeof( INST_ENTRY * ) );
+    memset( instIndex.buckets, 0, size * sizeof( INST_ENTRY * ) );
+    instIndex.size = size;
+    for( i = old_size; i-- > 0; ) {
+        for( curr = old_buckets[i]; curr != NULL; curr = next ) {
+            next = curr->next;
+            head = instBucket( curr->owner, curr->hash );
+            curr->next = *head;
+            *head = curr;
+        }
+    }
+    CMemFree( old_buckets );
+    ExtraRptIncrementCtr( ctr_inst_resizes );
+}
+
+static void instIndexInsert( void *owner, void *inst, unsigned hash )
+{
+    INST_ENTRY *entry;
+    INST_ENTRY **head;
+
+    if( instIndex.count >= instIndex.size ) {
+        instIndexResize( ( instIndex.size == 0 ) ? INST_INDEX_MIN
+                                                 : instIndex.size * 2 );
+    }
+    entry = CarveAlloc( carveINST_ENTRY );
+    entry->owner = owner;
+    entry->inst = inst;
+    entry->hash = hash;
+    head = instBucket( owner, hash );
+    entry->next = *head;                // newest first, like the old
+    *head = entry;                      // "last match in the ring wins"
+    instIndex.count++;
+    ExtraRptIncrementCtr( ctr_inst_entries );
+}
+
+static void instIndexRebuild( void )
+// the index holds pointers and pointer hashes, so after a PCH has been
+// read it is built again from the rings
+{
+    TEMPLATE_INFO *tinfo;
+    UNBOUND_TEMPLATE *unbound;
+    TEMPLATE_SPECIALIZATION *tspec;
+    CLASS_INST *inst;
+    FN_TEMPLATE *fn_templ;
+    FN_TEMPLATE_INST *fn_inst;
+
+    instIndex.stale = FALSE;
+    instIndexFree();
+    RingIterBeg( allClassTemplates, tinfo ) {
+        RingIterBeg( tinfo->unbound_templates, unbound ) {
+            unbound->hash =
+                hashParmScope( unbound->unbound_type->u.c.scope->enclosing );
+            instIndexInsert( tinfo, unbound, unbound->hash );
+        } RingIterEnd( unbound )
+        RingIterBeg( tinfo->specializations, tspec ) {
+            RingIterBeg( tspec->instantiations, inst ) {
+                instIndexInsert( tspec, inst,
+                                 hashParmScope( classInstParmScope( inst ) ) );
+            } RingIterEnd( inst )
+        } RingIterEnd( tspec )
+    } RingIterEnd( tinfo )
+    RingIterBeg( allFunctionTemplates, fn_templ ) {
+        RingIterBeg( fn_templ->instantiations, fn_inst ) {
+            instIndexInsert( fn_templ, fn_inst,
+                             hashFnParmScope( fn_inst->parm_scope ) );
+        } RingIterEnd( fn_inst )
+    } RingIterEnd( fn_templ )
+}
+
+static void instIndexAdd( void *owner, void *inst, unsigned hash )
+{
+    if( instIndex.stale ) {
+        instIndexRebuild();
+    }
+    instIndexInsert( owner, inst, hash );
+}
+
+static INST_ENTRY *instIndexFirst( void *owner, unsigned hash )
+// returns the first index entry which may match (see instIndexNext)
+{
+    if( instIndex.stale ) {
+        instIndexRebuild();
+    }
+    ExtraRptIncrementCtr( ctr_inst_lookups );
+    if( instIndex.size == 0 ) {
+        return( NULL );
+    }
+    return( *instBucket( owner, hash ) );
+}
+
+static INST_ENTRY *instIndexNext( INST_ENTRY *curr, void *owner, unsigned hash )
+// returns the first entry at or after curr for owner with the same hash
+{
+    for( ; curr != NULL; curr = curr->next ) {
+        if( ( curr->owner == owner ) && ( curr->hash == hash ) ) {
+            ExtraRptIncrementCtr( ctr_inst_probes );
+            break;
+        }
+    }
+    return( curr );
+}
+
 static void templateInit( INITFINI* defn )
 {
     defn = defn;
@@ -246,6 +568,13 @@ static void templateInit( INITFINI* defn )
     carveCLASS_INST = CarveCreate( sizeof( CLASS_INST ), BLOCK_CLASS_INST );
     carveTEMPLATE_MEMBER = CarveCreate( sizeof( TEMPLATE_MEMBER ), BLOCK_TEMPLATE_MEMBER );
     carveFN_TEMPLATE = CarveCreate( sizeof( FN_TEMPLATE ), BLOCK_FN_TEMPLATE );
+    carveINST_ENTRY = CarveCreate( sizeof( INST_ENTRY ), BLOCK_INST_ENTRY );
+    memset( &instIndex, 0, sizeof( instIndex ) );
+    ExtraRptRegisterCtr( &ctr_inst_lookups, "# template instantiation lookups" );
+    ExtraRptRegisterCtr( &ctr_inst_probes, "# template instantiations compared" );
+    ExtraRptRegisterCtr( &ctr_inst_found, "# template instantiations reused" );
+    ExtraRptRegisterCtr( &ctr_inst_entries, "# template instantiations indexed" );
+    ExtraRptRegisterCtr( &ctr_inst_resizes, "# template instantiation index resizes" );
 }
 
 static void templateFini( INITFINI *defn )
@@ -255,6 +584,8 @@ static void templateFini( INITFINI *defn )
     CarveDestroy( carveCLASS_INST );
     CarveDestroy( carveTEMPLATE_MEMBER );
     CarveDestroy( carveFN_TEMPLATE );
+    CMemFreePtr( &instIndex.buckets );
+    CarveDestroy( carveINST_ENTRY );
 }
 
 INITDEFN( template, templateInit, templateFini )
@@ -1587,6 +1918,7 @@ static SYMBOL buildTemplateFn( TYPE bound_type, SYMBOL sym, DECL_INFO *dinfo,
     fn_inst->parm_scope = parm_scope;
     fn_inst->inst_scope = inst_scope;
     fn_inst->processed = FALSE;
+    instIndexAdd( fn_templ, fn_inst, hashFnParmScope( parm_scope ) );
 
     return new_sym;
 }
@@ -1598,10 +1930,12 @@ SYMBOL TemplateFunctionGenerate( SYMBOL sym, arg_list *args,
     DECL_INFO *dinfo;
     FN_TEMPLATE *fn_templ;
     FN_TEMPLATE_INST *fn_inst;
+    INST_ENTRY *entry;
     TYPE fn_type;
     SCOPE parm_scope;
     SYMBOL generated_fn;
     bgt_control control;
+    unsigned hash;
 
     control = BGT_TRIVIAL;
     dinfo = attemptGen( args, sym, templ_args, locn, &parm_scope, &control );
@@ -1620,9 +1954,16 @@ SYMBOL TemplateFunctionGenerate( SYMBOL sym, arg_list *args,
     generated_fn = NULL;
 
     // check if we have already instantiated this template function
-    RingIterBeg( fn_templ->instantiations, fn_inst ) {
+    // (the index returns the newest instantiation first)
+    hash = hashFnParmScope( parm_scope );
+    entry = instIndexFirst( fn_templ, hash );
+    for( ; generated_fn == NULL; entry = entry->next ) {
         SYMBOL inst_sym;
 
+        entry = instIndexNext( entry, fn_templ, hash );
+        if( entry == NULL ) break;
+        fn_inst = entry->inst;
+
         inst_sym = SymDefaultBase( fn_inst->bound_sym );
 
         if( TypeCompareExclude( fn_type, inst_sym->sym_type,
@@ -1668,7 +2009,10 @@ SYMBOL TemplateFunctionGenerate( SYMBOL sym, arg_list *args,
                 break;
             }
         }
-    } RingIterEnd( fn_inst )
+    }
+    if( generated_fn != NULL ) {
+        ExtraRptIncrementCtr( ctr_inst_found );
+    }
 
 #ifndef NDEBUG
     if( PragDbgToggle.templ_function && ( generated_fn == NULL ) ) {
@@ -2188,18 +2532,21 @@ static SCOPE findInstScope( TEMPLATE_SPECIALIZATION *tspec, PTREE parms,
                             CLASS_INST **inst )
 {
     CLASS_INST *curr;
-    SCOPE parm_scope;
-
-    RingIterBeg( tspec->instantiations, curr ) {
-        parm_scope = curr->scope->enclosing;
-        if( ScopeType( parm_scope, SCOPE_TEMPLATE_SPEC_PARM ) ) {
-            parm_scope = parm_scope->enclosing;
-        }
-        if( sameParms( parm_scope, parms ) ) {
+    INST_ENTRY *entry;
+    unsigned hash;
+
+    hash = hashParmList( parms );
+    entry = instIndexFirst( tspec, hash );
+    for( ; ; entry = entry->next ) {
+        entry = instIndexNext( entry, tspec, hash );
+        if( entry == NULL ) break;
+        curr = entry->inst;
+        if( sameParms( classInstParmScope( curr ), parms ) ) {
+            ExtraRptIncrementCtr( ctr_inst_found );
             *inst = curr;
             return( curr->scope );
         }
-    } RingIterEnd( curr )
+    }
     return( NULL );
 }
 
@@ -2345,6 +2692,8 @@ static TYPE instantiateClass( TEMPLATE_INFO *tinfo, PTREE parms,
     }
 
     injectTemplateParms( tspec, parm_scope, parms, spec_parm_scope != NULL );
+    instIndexAdd( tspec, curr_instantiation,
+                  hashParmScope( classInstParmScope( curr_instantiation ) ) );
     ScopeAdjustUsing( NULL, inst_scope );
 
     new_type = doParseClassTemplate( tspec, tspec->defn, locn );
@@ -2566,6 +2915,7 @@ TYPE TemplateClassReference( PTREE tid, PTREE parms )
     parms = processClassTemplateParms( tinfo, parms, &is_generic );
     if( parms != NULL ) {
         UNBOUND_TEMPLATE *curr;
+        INST_ENTRY *entry;
         unsigned int hash;
 
 #ifndef NDEBUG
@@ -2580,20 +2930,22 @@ TYPE TemplateClassReference( PTREE tid, PTREE parms )
 #endif
 
         typ = NULL;
-        hash = 0;
-
-        RingIterBeg( tinfo->unbound_templates, curr ) {
-            SCOPE parm_scope = curr->unbound_type->u.c.scope->enclosing;
-
-            if( ( curr->hash == hash )
-             && sameParms( parm_scope, parms ) ) {
+        hash = hashParmList( parms );
+
+        entry = instIndexFirst( tinfo, hash );
+        for( ; ; entry = entry->next ) {
+            entry = instIndexNext( entry, tinfo, hash );
+            if( entry == NULL ) break;
+            curr = entry->inst;
+            if( sameParms( curr->unbound_type->u.c.scope->enclosing, parms ) ) {
+                ExtraRptIncrementCtr( ctr_inst_found );
                 typ = curr->unbound_type;
                 if( typ->of != NULL ) {
                     typ = typ->of;
                 }
                 break;
             }
-        } RingIterEnd( curr )
+        }
 
         if( typ == NULL ) {
             typ = createUnboundClass( tinfo, parms, is_generic );
@@ -2602,7 +2954,9 @@ TYPE TemplateClassReference( PTREE tid, PTREE parms )
                     CPermAlloc( sizeof( UNBOUND_TEMPLATE ) );
                 RingAppend( &tinfo->unbound_templates, unbound_templ );
                 unbound_templ->unbound_type = typ;
-                unbound_templ->hash = 0;
+                unbound_templ->hash =
+                    hashParmScope( typ->u.c.scope->enclosing );
+                instIndexAdd( tinfo, unbound_templ, unbound_templ->hash );
             }
         }
 
@@ -3321,6 +3675,8 @@ void TemplateSpecificDefnStart( PTREE tid, TYPE type )
         instance = newClassInstantiation( tprimary, type,
                                           inst_scope, TRUE );
         injectTemplateParms( NULL, parm_scope, parms, FALSE );
+        instIndexAdd( tprimary, instance,
+                      hashParmScope( classInstParmScope( instance ) ) );
     }
     DbgAssert( instance->specific );
     NodeFreeDupedExpr( parms );
@@ -3949,6 +4305,8 @@ pch_status PCHReadTemplates( void )
             RingAppend( &ti->specializations, ts );
         }
     }
+    // the instantiation index is not saved; rebuild it on first use
+    instIndex.stale = TRUE;
 
     return( PCHCB_OK );
 }
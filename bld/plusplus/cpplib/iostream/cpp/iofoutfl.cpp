@@ -50,8 +50,8 @@ enum {
 #else
 enum {
     FLOAT_OVERHEAD  = 7,            // 2 signs, decimal, E, 3-digit exponent
-    MAX_PREC        = DBL_DIG,
-    LONGEST_FLOAT   = DBL_DIG + FLOAT_OVERHEAD
+    MAX_PREC        = DBL_DIG + 2,  // enough for any double to read back
+    LONGEST_FLOAT   = MAX_PREC + FLOAT_OVERHEAD
 };
 #endif
 
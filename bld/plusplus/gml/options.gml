@@ -496,6 +496,20 @@
 :usage. set error file name
 :jusage. G[t@Cݒ肵܂
 
+:option. ftr
+:target. any
+:file.
+:optional.
+:usage. report compile time and memory by phase
+:jusage. RpCԂƃgpʂtF[Yʂɕ񍐂܂
+
+:option. ftrj
+:target. any
+:file.
+:optional.
+:usage. report compile time and memory by phase in JSON
+:jusage. RpCԂƃgpʂJSON`ŕ񍐂܂
+
 :option. ft
 :target. any
 :enumerate. file_83
@@ -573,6 +587,11 @@
 :usage. generate backward compatible 80x87 code
 :jusage. o[W9.0ȑOƌ݊80x87R[h𐶐܂
 
+:option. fps
+:target. 386
+:usage. use SSE2 to convert floating-point to integer
+:jusage.
+
 :option. fpd
 :target. i86 386
 :usage. enable Pentium FDIV check
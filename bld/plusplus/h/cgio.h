@@ -87,6 +87,9 @@ struct cgfile {                 // CGFILE -- control for a virtual file
           } s;  // of struct
         };      // of union
     SYMBOL      opt_retn;       // - symbol translated for optimized return
+    CGFILE      *hash_next;     // - next file in symbol hash chain
+    CGFILE      **ring;         // - ring containing the file
+    unsigned    ring_seq;       // - order of entry into that ring
 };
 
 struct cgfile_gen {             // CGFILE_GEN -- data while generating file
@@ -0,0 +1,77 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*    Portions Copyright (c) 1983-2002 Sybase, Inc. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Compile-time and memory report by compiler phase.
+*
+****************************************************************************/
+
+
+
+#ifndef __CMPTIME_H__
+#define __CMPTIME_H__
+
+#include <time.h>
+
+// CMPTIME.H -- compile-time and memory report (-ftr, -ftrj)
+
+typedef enum                    // COMPILER PHASES (FRONT END, THEN CODEGEN)
+{   CTP_PARSE                   // - parsing, semantic analysis
+,   CTP_PREPROC                 // - pre-processor directives
+,   CTP_TEMPLATE                // - template instantiation
+,   CTP_BACK_END                // - IC generation for the code generator
+,   CTP_CG_OPTIMIZE             // - cg: tree/instruction optimization
+,   CTP_CG_LOOP_OPT             // - cg: loop optimizations
+,   CTP_CG_REG_ALLOC            // - cg: register allocation
+,   CTP_CG_SCHEDULE             // - cg: instruction scheduling
+,   CTP_CG_ENCODE               // - cg: prolog/epilog, peephole, encoding
+,   CTP_CG_OBJECT               // - cg: object file write
+,   CTP_MAX
+} comp_phase;
+
+comp_phase CompTimePhase(       // SET FRONT-END PHASE
+    comp_phase phase )          // - new phase
+;
+void CompTimeCgPhase(           // SET PHASE REPORTED BY CODE GENERATOR
+    int cg_phase )              // - code generator phase
+;
+clock_t CompTimeStamp(          // GET TIME STAMP FOR FUNCTION TIMING
+    void )
+;
+void CompTimeFunction(          // RECORD TIME SPENT ON A FUNCTION
+    SYMBOL func,                // - function (NULL ==> module data)
+    clock_t start )             // - time stamp at start
+;
+void CompTimeSetFileName(       // SET REPORT FILE NAME
+    char *name )                // - name (NULL ==> standard output)
+;
+void CompTimeStart(             // START TIMING A SOURCE FILE
+    void )
+;
+void CompTimeReport(            // PRODUCE THE REPORT
+    void )
+;
+
+#endif
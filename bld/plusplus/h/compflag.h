@@ -245,6 +245,8 @@ typedef struct comp_flags {
     unsigned no_alternative_tokens  : 1;    // disable alternative tokens
 /*  160 */
     unsigned enable_std0x           : 1;    // enable some C++0x features
+    unsigned time_report            : 1;    // report compile time by phase
+    unsigned time_report_json       : 1;    // - in JSON format
     
 
 /*****************************************************************************
@@ -106,6 +106,7 @@ EXIT_END
 //   can generate browsing information
 EXIT_BEG( cpp_front_end )       // cmd line, pre-processing, analysis, codegen
   EXIT_REG( cgio )
+  EXIT_REG( comp_time )
   SPLIT_INIT( statistics, cpp_analysis )
 #ifdef OPT_BR
   EXIT_REG( browse_info )
@@ -50,9 +50,9 @@ struct test_case {
     int   size;               // The number of elements in input I care about.
 };
 
-// The test cases. The current version of std::sort uses QuickSort but falls over to
-// InsertionSort on subsequences of length <= 10. Thus it is important to use test cases that
-// are longer than 10 to properly exercise both algorithms.
+// The test cases. The current version of std::sort uses QuickSort but leaves subsequences
+// shorter than 16 for a final InsertionSort pass. Thus it is important to use test cases that
+// are longer than 16 to properly exercise both algorithms.
 //
 // Note that the 'title' member is no longer used but it is retained for documentation and
 // possible future use.
@@ -106,8 +106,8 @@ const struct test_case tests[] = {
         { 1, 1, 1, 1, 1 },
         { 1, 1, 1, 1, 1 }, 5 },
 
-    // The following tests are all length 11. This is the first length at which a partitioning
-    // is done.
+    // The following tests are all length 11. These were the first partitioned sequences when
+    // the insertion sort threshold was 10; they are now handled by insertion sort alone.
 
     { "LONG: Random elements; median3 in middle",
         {  3,  4,  1,  9, 10,  5,  7, 11,  2,  6,  8 },
@@ -194,8 +194,8 @@ const struct test_case reverse_tests[] = {
         { 1, 1, 1, 1, 1 },
         { 1, 1, 1, 1, 1 }, 5 },
 
-    // The following tests are all length 11. This is the first length at which a partitioning
-    // is done.
+    // The following tests are all length 11. These were the first partitioned sequences when
+    // the insertion sort threshold was 10; they are now handled by insertion sort alone.
 
     { "LONG: Random elements; median3 in middle",
         {  3,  4,  1,  9, 10,  5,  7, 11,  2,  6,  8 },
@@ -331,6 +331,83 @@ bool reverse_sort_test( )
     return( true );
 }
 
+bool long_sort_test( )
+{
+    // Long inputs that push a plain QuickSort toward its worst case. With 1000 elements the
+    // introsort depth limit is small enough that some of these fall back to HeapSort.
+    const int size = 1000;
+    int *data = new int[size];
+
+    for( int shape = 0; shape < 4; ++shape ) {
+        for( int i = 0; i < size; ++i ) {
+            switch( shape ) {
+            case 0: data[i] = size - i; break;                      // Reversed.
+            case 1: data[i] = ( i < size/2 ) ? i : size - i; break; // Organ pipe.
+            case 2: data[i] = i % 3; break;                         // Many duplicates.
+            case 3: data[i] = ( i % 2 ) ? i : size + i; break;      // Interleaved.
+            }
+        }
+        std::sort( data, data + size );
+        for( int i = 1; i < size; ++i ) {
+            if( data[i] < data[i - 1] ) { delete [] data; FAIL; }
+        }
+    }
+    delete [] data;
+    return( true );
+}
+
+// Elements for the stable_sort test. Only 'key' takes part in the ordering.
+struct keyed {
+    int key;
+    int order;
+};
+
+struct keyed_less {
+    bool operator()( const keyed &x, const keyed &y ) const
+        { return( x.key < y.key ); }
+};
+
+bool stable_sort_test( )
+{
+    // Use the same cases as sort_test first; stable_sort must give the same answers.
+    test_case *tc = new test_case[number_cases];
+    for( int i = 0; i < number_cases; ++i ) tc[i] = tests[i];
+
+    for( int i = 0; i < number_cases; ++i ) {
+        std::stable_sort( &tc[i].input[0], &tc[i].input[tc[i].size] );
+        for( int j = 0; j < tc[i].size; ++j ) {
+            if ( tc[i].input[j] != tc[i].expected[j] ) { delete [] tc; FAIL; }
+        }
+    }
+    delete [] tc;
+
+    // Now check that equal keys keep their original order. The size is large enough to
+    // need several levels of merging.
+    const int size = 200;
+    keyed data[size];
+    for( int i = 0; i < size; ++i ) {
+        data[i].key   = ( i * 7 ) % 5;
+        data[i].order = i;
+    }
+    std::stable_sort( data, data + size, keyed_less( ) );
+    for( int i = 1; i < size; ++i ) {
+        if( data[i].key < data[i - 1].key ) FAIL;
+        if( data[i].key == data[i - 1].key && data[i].order < data[i - 1].order ) FAIL;
+    }
+
+    // std::string has a non-trivial copy, which exercises the merge buffer's bookkeeping.
+    std::string words[] = {
+        "pear", "fig", "apple", "kiwi", "plum", "date", "lime", "sloe", "yuzu",
+        "apple", "fig", "pear", "lime", "date", "kiwi", "plum", "sloe", "yuzu", "fig"
+    };
+    const int word_count = sizeof( words ) / sizeof( words[0] );
+    std::stable_sort( words, words + word_count );
+    for( int i = 1; i < word_count; ++i ) {
+        if( words[i] < words[i - 1] ) FAIL;
+    }
+    return( true );
+}
+
 bool bsearch_test( )
 {
     using std::binary_search;
@@ -456,6 +533,8 @@ int main( )
         if( !bsearch_test( )         || !heap_ok( "t05" ) ) rc = 1;
         if( !lexicographical_test( ) || !heap_ok( "t06" ) ) rc = 1;
         if( !permutation_test( )     || !heap_ok( "t07" ) ) rc = 1;
+        if( !long_sort_test( )       || !heap_ok( "t08" ) ) rc = 1;
+        if( !stable_sort_test( )     || !heap_ok( "t09" ) ) rc = 1;
     }
     catch( ... ) {
         std::cout << "Unexpected exception of unexpected type.\n";
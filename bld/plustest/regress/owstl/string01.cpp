@@ -31,6 +31,7 @@
 *
 ****************************************************************************/
 
+#include <cstring>
 #include <iostream>
 #include <string>
 
@@ -730,6 +731,104 @@ bool substr_test()
 }
 
 
+// The strings below straddle the 15 characters held inside the string
+// object itself, so they move between the inline buffer and the heap.
+bool sso_test( )
+{
+  bool rc = true;
+  const char *fifteen = "abcdefghijklmno";
+  const char *sixteen = "abcdefghijklmnop";
+  const char *long_string = "This string is much too long to be held inline";
+
+  // Grow one character at a time past the inline buffer.
+  std::string s1;
+  for( std::string::size_type i = 0; i < 16; ++i ) {
+    s1.push_back( sixteen[i] );
+    if( s1.size( ) != i + 1 || INSANE( s1 ) ) FAIL
+    if( std::strncmp( s1.c_str( ), sixteen, i + 1 ) != 0 ) FAIL
+    if( s1.c_str( )[i + 1] != '\0' ) FAIL
+  }
+  if( s1 != sixteen ) FAIL
+  s1.append( "qrstuvwxyz" );
+  if( s1.size( ) != 26 || s1 != "abcdefghijklmnopqrstuvwxyz" || INSANE( s1 ) ) FAIL
+
+  // Shrink back below it and grow again.
+  s1.erase( 15 );
+  if( s1.size( ) != 15 || s1 != fifteen || INSANE( s1 ) ) FAIL
+  s1.resize( 3 );
+  if( s1.size( ) != 3 || s1 != "abc" || INSANE( s1 ) ) FAIL
+  s1.insert( 1, long_string );
+  if( s1.size( ) != std::strlen( long_string ) + 3 || INSANE( s1 ) ) FAIL
+  if( s1.substr( 1, s1.size( ) - 3 ) != long_string ) FAIL
+  s1 = "";
+  if( s1.size( ) != 0 || s1 != "" || INSANE( s1 ) ) FAIL
+
+  // Exactly fifteen and sixteen characters.
+  std::string s2( fifteen );
+  std::string s3( sixteen );
+  if( s2.size( ) != 15 || s2 != fifteen || INSANE( s2 ) ) FAIL
+  if( s3.size( ) != 16 || s3 != sixteen || INSANE( s3 ) ) FAIL
+  s2 += 'p';
+  if( s2 != s3 || INSANE( s2 ) ) FAIL
+  s3.erase( s3.size( ) - 1 );
+  if( s3 != fifteen || INSANE( s3 ) ) FAIL
+
+  // Copies between short and long strings.
+  std::string shrt( "short" );
+  std::string lng( long_string );
+  std::string c1( shrt );
+  std::string c2( lng );
+  if( c1 != shrt || INSANE( c1 ) ) FAIL
+  if( c2 != lng  || INSANE( c2 ) ) FAIL
+  c1 = lng;
+  if( c1 != long_string || INSANE( c1 ) ) FAIL
+  c2 = shrt;
+  if( c2 != "short" || INSANE( c2 ) ) FAIL
+  c1 = c2;
+  if( c1 != "short" || INSANE( c1 ) ) FAIL
+  c1 = c1;
+  if( c1 != "short" || INSANE( c1 ) ) FAIL
+  c2.assign( lng, 5, 20 );
+  if( c2 != "string is much too l" || INSANE( c2 ) ) FAIL
+  c2.assign( shrt, 1, 3 );
+  if( c2 != "hor" || INSANE( c2 ) ) FAIL
+  std::string c3( lng, 0, 4 );
+  if( c3 != "This" || INSANE( c3 ) ) FAIL
+  // The copy must not share the other string's inline buffer.
+  c3 = shrt;
+  c3[0] = 'S';
+  if( shrt != "short" || c3 != "Short" ) FAIL
+
+  // Swaps: short with short, short with long, long with long, itself.
+  std::string w1( "one" );
+  std::string w2( "two" );
+  std::string w3( long_string );
+  std::string w4( sixteen );
+  w1.swap( w2 );
+  if( w1 != "two" || w2 != "one" || INSANE( w1 ) || INSANE( w2 ) ) FAIL
+  w1.swap( w3 );
+  if( w1 != long_string || w3 != "two" || INSANE( w1 ) || INSANE( w3 ) ) FAIL
+  w3.swap( w1 );
+  if( w3 != long_string || w1 != "two" || INSANE( w1 ) || INSANE( w3 ) ) FAIL
+  w3.swap( w4 );
+  if( w3 != sixteen || w4 != long_string || INSANE( w3 ) || INSANE( w4 ) ) FAIL
+  w4.swap( w4 );
+  if( w4 != long_string || INSANE( w4 ) ) FAIL
+  w1.swap( w1 );
+  if( w1 != "two" || INSANE( w1 ) ) FAIL
+  // Swapped short strings must still be usable on their own.
+  w1 += " and more, until it is long";
+  if( w1 != "two and more, until it is long" || w2 != "one" ) FAIL
+  if( INSANE( w1 ) || INSANE( w2 ) ) FAIL
+
+  // Reserve on a short string moves it to the heap and keeps it.
+  std::string r1( "abc" );
+  r1.reserve( 100 );
+  if( r1.capacity( ) < 100 || r1 != "abc" || INSANE( r1 ) ) FAIL
+  return( rc );
+}
+
+
 // Main Program
 // ============
 
@@ -760,6 +859,7 @@ int main( )
     if( !find_first_not_of_test( ) || !heap_ok( "t19" ) ) rc = 1;
     if( !find_last_not_of_test( )  || !heap_ok( "t20" ) ) rc = 1;
     if( !substr_test( )            || !heap_ok( "t21" ) ) rc = 1;
+    if( !sso_test( )               || !heap_ok( "t22" ) ) rc = 1;
   }
   catch( std::out_of_range e ) {
     std::cout << "Unexpected out_of_range exception: " << e.what( ) << "\n";
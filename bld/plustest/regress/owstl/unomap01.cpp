@@ -0,0 +1,155 @@
+/****************************************************************************
+*
+*                            Open Watcom Project
+*
+*  Copyright (c) 2004-2006 The Open Watcom Contributors. All Rights Reserved.
+*
+*  ========================================================================
+*
+*    This file contains Original Code and/or Modifications of Original
+*    Code as defined in and that are subject to the Sybase Open Watcom
+*    Public License version 1.0 (the 'License'). You may not use this file
+*    except in compliance with the License. BY USING THIS FILE YOU AGREE TO
+*    ALL TERMS AND CONDITIONS OF THE LICENSE. A copy of the License is
+*    provided with the Original Code and Modifications, and is also
+*    available at www.sybase.com/developer/opensource.
+*
+*    The Original Code and all software distributed under the License are
+*    distributed on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER
+*    EXPRESS OR IMPLIED, AND SYBASE AND ALL CONTRIBUTORS HEREBY DISCLAIM
+*    ALL SUCH WARRANTIES, INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF
+*    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR
+*    NON-INFRINGEMENT. Please see the License for the specific language
+*    governing rights and limitations under the License.
+*
+*  ========================================================================
+*
+* Description:  Functional tests for unordered map.
+*
+****************************************************************************/
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+#include "sanity.cpp"
+
+/* ------------------------------------------------------------------
+ * access_test( )
+ * insert, operator[], find, erase on a map with unique keys
+ */
+bool access_test( )
+{
+    typedef std::tr1::unordered_map< int, int > m_t;
+    m_t m1;
+    int i;
+
+    for( i = 0; i < 1000; i++ ) {
+        m1[ i * 7 ] = i;
+        if( INSANE( m1 ) || m1.size( ) != i + 1 ) FAIL
+    }
+    for( i = 0; i < 1000; i++ ) {
+        m_t::iterator it = m1.find( i * 7 );
+        if( it == m1.end( ) || it->first != i * 7 || it->second != i ) FAIL
+        if( m1.find( i * 7 + 1 ) != m1.end( ) ) FAIL
+    }
+    std::pair< m_t::iterator, bool > r = m1.insert( m_t::value_type( 7, -1 ) );
+    if( r.second || r.first->second != 1 || m1.size( ) != 1000 ) FAIL
+    m1[ 7 ] = -1;
+    if( m1.find( 7 )->second != -1 || m1.size( ) != 1000 ) FAIL
+    for( i = 0; i < 1000; i += 2 ) {
+        if( m1.erase( i * 7 ) != 1 ) FAIL
+    }
+    if( INSANE( m1 ) || m1.size( ) != 500 ) FAIL
+    for( i = 0; i < 1000; i++ ) {
+        if( m1.count( i * 7 ) != ( i & 1 ) ) FAIL
+    }
+    return( true );
+}
+
+/* ------------------------------------------------------------------
+ * string_test( )
+ * non-trivial key type with a user hash function
+ */
+struct str_hash {
+    std::size_t operator()( const std::string &s ) const
+    {
+        std::size_t h = 0;
+        for( std::string::size_type i = 0; i < s.length( ); i++ ) {
+            h = h * 31 + static_cast< unsigned char >( s[i] );
+        }
+        return( h );
+    }
+};
+
+bool string_test( )
+{
+    typedef std::tr1::unordered_map< std::string, int, str_hash > m_t;
+    m_t m1;
+    char const *words[] = { "the", "quick", "brown", "fox", "jumps", "over",
+                            "the", "lazy", "dog", "the", "end" };
+    int const words_size = sizeof( words ) / sizeof( char const * );
+
+    for( int i = 0; i < words_size; i++ ) m1[ words[i] ]++;
+    if( INSANE( m1 ) || m1.size( ) != 9 ) FAIL
+    if( m1[ "the" ] != 3 || m1[ "fox" ] != 1 ) FAIL
+    if( m1.find( "cat" ) != m1.end( ) ) FAIL
+
+    m_t m2( m1 );
+    if( INSANE( m2 ) || m2.size( ) != 9 || m2[ "the" ] != 3 ) FAIL
+    m1.clear( );
+    if( INSANE( m1 ) || !m1.empty( ) || m2.size( ) != 9 ) FAIL
+    return( true );
+}
+
+/* ------------------------------------------------------------------
+ * multi_test( )
+ * unordered_multimap keeps every value for a key together
+ */
+bool multi_test( )
+{
+    typedef std::tr1::unordered_multimap< int, int > mm_t;
+    mm_t m1;
+    int i, j;
+
+    for( j = 0; j < 4; j++ ) {
+        for( i = 0; i < 50; i++ ) m1.insert( mm_t::value_type( i, j ) );
+    }
+    if( INSANE( m1 ) || m1.size( ) != 200 ) FAIL
+    for( i = 0; i < 50; i++ ) {
+        std::pair< mm_t::iterator, mm_t::iterator > r = m1.equal_range( i );
+        int seen = 0;
+        for( ; r.first != r.second; ++r.first ) {
+            if( r.first->first != i ) FAIL
+            seen |= 1 << r.first->second;
+        }
+        if( seen != 0xF ) FAIL
+    }
+    m1.rehash( 1000 );
+    if( INSANE( m1 ) || m1.count( 10 ) != 4 ) FAIL
+    if( m1.erase( 10 ) != 4 || INSANE( m1 ) || m1.size( ) != 196 ) FAIL
+    return( true );
+}
+
+
+int main( )
+{
+  int rc = 0;
+  int original_count = heap_count( );
+
+  try {
+    if( !access_test( )  || !heap_ok( "t01" ) ) rc = 1;
+    if( !string_test( )  || !heap_ok( "t02" ) ) rc = 1;
+    if( !multi_test( )   || !heap_ok( "t03" ) ) rc = 1;
+  }
+  catch( ... ) {
+    std::cout << "Unexpected exception of unexpected type.\n";
+    rc = 1;
+  }
+
+  if( heap_count( ) != original_count ) {
+    std::cout << "Possible memory leak!\n";
+    rc = 1;
+  }
+  return( rc );
+}
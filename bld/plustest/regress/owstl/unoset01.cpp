@@ -33,13 +33,143 @@
 
 #include "sanity.cpp"
 
-bool some_test( )
+/* ------------------------------------------------------------------
+ * access_test( )
+ * insert, find, erase, count on a set with unique keys
+ */
+bool access_test( )
 {
-  bool rc = true;
+    typedef std::tr1::unordered_set< int > s_t;
+    s_t s1;
 
-  // Exercise some facility here.
+    int num[] = { 11, 10, 4, 8, 2, 1, 12, 13, 19, 7, 18, 17 };
+    int notnum[] = { 3, 5, 6, 9, 14, 15, 16 };
+    int const num_size = sizeof( num ) / sizeof( int );
+    int const notnum_size = sizeof( notnum ) / sizeof( int );
 
-  return( rc );
+    if( INSANE( s1 ) || s1.size( ) != 0 || !s1.empty( ) ) FAIL
+    for( int i = 0; i < num_size; i++ ) {
+        std::pair< s_t::iterator, bool > r = s1.insert( num[i] );
+        if( INSANE( s1 ) || s1.size( ) != i + 1 || !r.second || *r.first != num[i] ) FAIL
+    }
+    for( int i = 0; i < num_size; i++ ) {
+        std::pair< s_t::iterator, bool > r = s1.insert( num[i] );
+        if( INSANE( s1 ) || s1.size( ) != num_size || r.second || *r.first != num[i] ) FAIL
+    }
+    for( int i = 0; i < num_size; i++ ) {
+        s_t::iterator it = s1.find( num[i] );
+        if( it == s1.end( ) || *it != num[i] || s1.count( num[i] ) != 1 ) FAIL
+    }
+    for( int i = 0; i < notnum_size; i++ ) {
+        if( s1.find( notnum[i] ) != s1.end( ) || s1.count( notnum[i] ) != 0 ) FAIL
+    }
+    if( s1.erase( 11 ) != 1 || s1.erase( 11 ) != 0 ) FAIL
+    if( INSANE( s1 ) || s1.size( ) != num_size - 1 ) FAIL
+    s1.erase( s1.find( 4 ) );
+    if( INSANE( s1 ) || s1.size( ) != num_size - 2 || s1.count( 4 ) != 0 ) FAIL
+    s1.clear( );
+    if( INSANE( s1 ) || s1.size( ) != 0 || s1.begin( ) != s1.end( ) ) FAIL
+    return( true );
+}
+
+/* ------------------------------------------------------------------
+ * multi_test( )
+ * equivalent keys in unordered_multiset stay together
+ */
+bool multi_test( )
+{
+    typedef std::tr1::unordered_multiset< int > ms_t;
+    ms_t s1;
+
+    for( int j = 0; j < 5; j++ ) {
+        for( int i = 0; i < 100; i++ ) s1.insert( i );
+    }
+    if( INSANE( s1 ) || s1.size( ) != 500 ) FAIL
+    for( int i = 0; i < 100; i++ ) {
+        if( s1.count( i ) != 5 ) FAIL
+        std::pair< ms_t::iterator, ms_t::iterator > r = s1.equal_range( i );
+        int c = 0;
+        for( ; r.first != r.second; ++r.first ) {
+            if( *r.first != i ) FAIL
+            c++;
+        }
+        if( c != 5 ) FAIL
+    }
+    if( s1.erase( 42 ) != 5 || INSANE( s1 ) || s1.size( ) != 495 ) FAIL
+    s1.erase( s1.find( 43 ) );
+    if( s1.count( 43 ) != 4 || INSANE( s1 ) ) FAIL
+    return( true );
+}
+
+/* ------------------------------------------------------------------
+ * bucket_test( )
+ * bucket interface and hash policy
+ */
+bool bucket_test( )
+{
+    typedef std::tr1::unordered_set< int > s_t;
+    s_t s1;
+    int i;
+
+    for( i = 0; i < 1000; i++ ) s1.insert( i * 3 );
+    if( INSANE( s1 ) || s1.load_factor( ) > s1.max_load_factor( ) ) FAIL
+
+    s_t::size_type total = 0;
+    for( s_t::size_type b = 0; b < s1.bucket_count( ); b++ ) {
+        s_t::size_type c = 0;
+        for( s_t::local_iterator it = s1.begin( b ); it != s1.end( b ); ++it ) {
+            if( s1.bucket( *it ) != b ) FAIL
+            c++;
+        }
+        if( c != s1.bucket_size( b ) ) FAIL
+        total += c;
+    }
+    if( total != s1.size( ) ) FAIL
+
+    s1.rehash( 5000 );
+    if( INSANE( s1 ) || s1.bucket_count( ) < 5000 || s1.size( ) != 1000 ) FAIL
+    s1.max_load_factor( 4.0f );
+    s1.rehash( 0 );
+    if( INSANE( s1 ) || s1.load_factor( ) > 4.0f ) FAIL
+    for( i = 0; i < 1000; i++ ) {
+        if( s1.count( i * 3 ) != 1 || s1.count( i * 3 + 1 ) != 0 ) FAIL
+    }
+    return( true );
+}
+
+/* ------------------------------------------------------------------
+ * copy_test( )
+ * copy constructor, assignment, iterator range constructor, swap
+ */
+bool copy_test( )
+{
+    typedef std::tr1::unordered_set< int > s_t;
+    s_t s1;
+    int i;
+
+    for( i = 0; i < 200; i++ ) s1.insert( i );
+    s_t s2( s1 );
+    if( INSANE( s2 ) || s2.size( ) != 200 ) FAIL
+    s_t s3;
+    s3.insert( 1000 );
+    s3 = s1;
+    if( INSANE( s3 ) || s3.size( ) != 200 || s3.count( 1000 ) != 0 ) FAIL
+    s_t s4( s1.begin( ), s1.end( ) );
+    if( INSANE( s4 ) || s4.size( ) != 200 ) FAIL
+
+    int n = 0;
+    for( s_t::const_iterator it = s4.begin( ); it != s4.end( ); ++it ) {
+        if( s1.count( *it ) != 1 ) FAIL
+        n++;
+    }
+    if( n != 200 ) FAIL
+
+    s_t s5;
+    swap( s4, s5 );
+    if( INSANE( s4 ) || INSANE( s5 ) || s4.size( ) != 0 || s5.size( ) != 200 ) FAIL
+    s5.erase( s5.begin( ), s5.end( ) );
+    if( INSANE( s5 ) || !s5.empty( ) ) FAIL
+    return( true );
 }
 
 
@@ -49,7 +179,10 @@ int main( )
   int original_count = heap_count( );
 
   try {
-    if( !some_test( )    || !heap_ok( "t01" ) ) rc = 1;
+    if( !access_test( )  || !heap_ok( "t01" ) ) rc = 1;
+    if( !multi_test( )   || !heap_ok( "t02" ) ) rc = 1;
+    if( !bucket_test( )  || !heap_ok( "t03" ) ) rc = 1;
+    if( !copy_test( )    || !heap_ok( "t04" ) ) rc = 1;
   }
   catch( ... ) {
     std::cout << "Unexpected exception of unexpected type.\n";
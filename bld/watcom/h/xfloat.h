@@ -142,6 +142,15 @@ extern  void    _LDScale10x( ld_arg, int );
 _WMRTLINK extern void  __cnvd2ld( double _WCNEAR *src, long_double _WCNEAR *dst );
 _WMRTLINK extern void  __cnvs2d( char *buf, double *value );
 _WMRTLINK extern int   __cnvd2f( double *src, float *tgt );
+
+/* shortest digits of a double and Eisel-Lemire parsing, kept out of
+ * the 16-bit libraries for the size of the table they use */
+#if !defined( _M_I86 )
+ #define __FAST_DBLCVT__
+extern  int     __DblShortest( double, char *, int * );
+extern  int     __DblFromDec( unsigned long long, int, double * );
+#endif
+
 #ifdef _LONG_DOUBLE_
 extern  void    __iLDFD( ld_arg, dbl_arg );
 extern  void    __iLDFS( ld_arg, flt_arg );
@@ -687,6 +687,24 @@ bool ProcCache( void )
     return( TRUE );
 }
 
+bool ProcReadAhead( void )
+/*******************************/
+/* process READAHEAD option */
+{
+    unsigned_32     value;
+    bool            ret;
+
+    ret = GetLong( &value );
+    if( ret ) {
+        if( value > MAX_READ_AHEAD ) {
+            LnkMsg( LOC+LINE+WRN+MSG_VALUE_INCORRECT, "s", "readahead" );
+        } else {
+            ReadAheadFiles = value;
+        }
+    }
+    return( ret );
+}
+
 static bool AddDisable( void )
 /****************************/
 /* disable an error message number */
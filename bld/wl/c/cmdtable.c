@@ -175,6 +175,7 @@ parse_entry     MainOptions[] = {
     "NOEXTension",  &ProcNoExtension,   MK_ALL, 0,
     "NOFARcalls",   &ProcNoFarCalls,    MK_ALL, 0,
     "CAChe",        &ProcCache,         MK_ALL, 0,
+    "READAhead",    &ProcReadAhead,     MK_ALL, 0,
     "MANGlednames", &ProcMangledNames,  MK_ALL, 0,
     "OBJAlign",     &ProcObjAlign,      MK_ALL, 0,
     "RESource",     &ProcOpResource,    MK_ALL, 0,
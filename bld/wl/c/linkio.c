@@ -192,6 +192,35 @@ static unsigned TestWrite( f_handle file, void *buffer, unsigned len, char *name
     return( TINY_INFO(h) );
 }
 
+void *QReadAhead( f_handle file, void *buffer, unsigned long len )
+/***********************************************************************/
+/* no threads here, so the caller has to read the file itself */
+{
+    file = file; buffer = buffer; len = len;
+    return( NULL );
+}
+
+bool QReadAheadWait( void *req )
+/*************************************/
+{
+    req = req;
+    return( FALSE );
+}
+
+void *QMapFile( f_handle file, unsigned long len )
+/*******************************************************/
+/* no memory mapped files here, the caller has to read the file itself */
+{
+    file = file; len = len;
+    return( NULL );
+}
+
+void QUnmapFile( void *addr, unsigned long len )
+/*****************************************************/
+{
+    addr = addr; len = len;
+}
+
 unsigned QWrite( f_handle file, void *buffer, unsigned len, char *name )
 /*****************************************************************************/
 {
@@ -258,6 +287,19 @@ unsigned long QPos( f_handle file )
     return( pos );
 }
 
+bool QTruncate( f_handle file, char *name )
+/************************************************/
+/* cut the file off at the current position (a zero length write does it) */
+{
+    tiny_ret_t  h;
+
+    h = TinyWrite( file, NULL, 0 );
+    if( TINY_OK( h ) )
+        return( TRUE );
+    LnkMsg( ERR+MSG_IO_PROBLEM, "12", name, QErrMsg( TINY_INFO( h ) ) );
+    return( FALSE );
+}
+
 unsigned long QFileSize( f_handle file )
 /*********************************************/
 {
@@ -1176,6 +1176,7 @@ void InitBuffFile( outfilelist *outfile, char *filename, bool executable )
     outfile->ovlfnoff = 0;
     outfile->is_exe   = executable;
     outfile->origin   = 0;
+    outfile->oldbuf   = NULL;
 }
 
 void SetOriginLoad( unsigned long origin )
@@ -1184,19 +1185,60 @@ void SetOriginLoad( unsigned long origin )
     CurrSect->outfile->origin = origin;
 }
 
+static bool UpdateInPlace( outfilelist *outfile )
+/***********************************************/
+// an incremental relink of a PE or ELF executable mostly produces the same
+// image again, so only the parts of the old file which differ are rewritten.
+{
+    time_t      modtime;
+
+    if( !(LinkFlags & INC_LINK_FLAG) || !(LinkState & GOT_PREV_STRUCTS) )
+        return( FALSE );
+    if( !(FmtData.type & (MK_PE | MK_ELF)) || FmtData.output_raw
+                                           || FmtData.output_hex )
+        return( FALSE );
+    if( outfile != Root->outfile || !outfile->is_exe )
+        return( FALSE );
+    return( !QModTime( outfile->fname, &modtime ) );
+}
+
 void OpenBuffFile( outfilelist *outfile )
 /**********************************************/
 {
-    if( outfile->is_exe )
+    if( UpdateInPlace( outfile ) ) {
+        outfile->handle = ExeOpen( outfile->fname );
+        if( outfile->handle != NIL_HANDLE ) {
+            _ChkAlloc( outfile->oldbuf, BUFF_BLOCK_SIZE );
+        }
+    } else if( outfile->is_exe ) {
         outfile->handle = ExeCreate( outfile->fname );
-    else
+    } else {
         outfile->handle = QOpenRW( outfile->fname );
+    }
     if( outfile->handle == NIL_HANDLE ) {
         PrintIOError( FTL+MSG_CANT_OPEN_NO_REASON, "s", outfile->fname );
     }
     _ChkAlloc( outfile->buffer, BUFF_BLOCK_SIZE );
 }
 
+static void WriteBlock( outfilelist *outfile, unsigned len )
+/**********************************************************/
+// write out the buffer. When updating the file in place, skip it if the
+// file already holds the same bytes.
+{
+    unsigned long   pos;
+
+    if( outfile->oldbuf != NULL ) {
+        pos = QPos( outfile->handle );
+        if( QRead( outfile->handle, outfile->oldbuf, len, outfile->fname ) == len
+            && memcmp( outfile->oldbuf, outfile->buffer, len ) == 0 ) {
+            return;
+        }
+        QSeek( outfile->handle, pos, outfile->fname );
+    }
+    QWrite( outfile->handle, outfile->buffer, len, outfile->fname );
+}
+
 static void FlushBuffFile( outfilelist *outfile )
 /***********************************************/
 {
@@ -1204,7 +1246,14 @@ static void FlushBuffFile( outfilelist *outfile )
 
     modpos = outfile->bufpos % BUFF_BLOCK_SIZE;
     if( modpos != 0 ) {
-        QWrite( outfile->handle, outfile->buffer, modpos, outfile->fname );
+        WriteBlock( outfile, modpos );
+    }
+    if( outfile->oldbuf != NULL ) {
+        // the buffered part is the bulk of the image; anything written after
+        // this only patches headers, so cut off what is left of the old file.
+        QTruncate( outfile->handle, outfile->fname );
+        _LnkFree( outfile->oldbuf );
+        outfile->oldbuf = NULL;
     }
     _LnkFree( outfile->buffer );
     outfile->buffer = NULL;
@@ -1232,8 +1281,7 @@ static void WriteBuffer( char *info, unsigned long len, outfilelist *outfile,
     while( modpos + len >= BUFF_BLOCK_SIZE ) {
         adjust = BUFF_BLOCK_SIZE - modpos;
         rtn( outfile->buffer + modpos, info, adjust );
-        QWrite( outfile->handle, outfile->buffer, BUFF_BLOCK_SIZE,
-                outfile->fname );
+        WriteBlock( outfile, BUFF_BLOCK_SIZE );
         info += adjust;
         len -= adjust;
         modpos = 0;
@@ -54,11 +54,36 @@
 #include "symtab.h"
 
 
-#define STATIC_TABSIZE  241  /* should be prime */
-#define GLOBAL_TABSIZE  1789  /* should be prime */
-
-#define STATIC_TABALLOC (256 * sizeof(symbol *))  // 1st power of 128 > TABSIZE
-#define GLOBAL_TABALLOC (1792 * sizeof(symbol *)) // 1st power of 128 > TABSIZE
+/* the symbol tables are open addressed, with linear probing.  They are
+ * doubled in size whenever they get half full. */
+
+#define STATIC_TABSIZE  256     /* initial size, must be a power of 2 */
+#define GLOBAL_TABSIZE  2048    /* initial size, must be a power of 2 */
+
+#define HASH_SEED       0x811C9DC5UL    /* FNV-1a basis & prime */
+#define HASH_PRIME      0x01000193UL
+#define HASH_SCATTER    0x9E3779B1UL    /* 2^32 / golden ratio */
+
+/* first slot to look at for hash value h, with tab->shift == 32 - log2(size) */
+#define FIRST_SLOT( tab, h )    ((unsigned)((unsigned_32)((h) * HASH_SCATTER) >> (tab)->shift))
+
+typedef struct {
+    symbol          *sym;       /* NULL if the slot is empty */
+    unsigned_32     hash;       /* hash value of the symbol name */
+    unsigned        len;        /* sym->namelen_cmp */
+} sym_slot;
+
+typedef struct {
+    sym_slot        *slots;
+    unsigned        size;       /* number of slots, a power of 2 */
+    unsigned        shift;
+    unsigned        used;       /* number of slots with a symbol */
+#ifdef _INT_DEBUG
+    unsigned_32     searches;   /* number of searches made */
+    unsigned_32     probes;     /* number of slots looked at by them */
+    unsigned        grown;      /* number of times the table was doubled */
+#endif
+} sym_table;
 
 int             (*CmpRtn)( const void *, const void *, size_t );
 unsigned        NameLen;
@@ -66,532 +91,12 @@ symbol          *LastSym;
 
 static  symbol  *SymList = NULL;
 
-// not a static array to save space for watfor
-
-static symbol   **GlobalSymPtrs;
-static symbol   **StaticSymPtrs;
-
-static unsigned GlobalHashFn( char *, unsigned );
-static unsigned StaticHashFn( char *, unsigned );
-static void     SetSymAlias( symbol *sym, char *target, unsigned targetlen );
-
-static const unsigned ScatterTable[] = {
-#ifdef __386__
-0x1DE82EE1,
-0x6E21134B,
-0x0F406D5B,
-0x07671454,
-0x3FE530A8,
-0x05D03ED8,
-0x63060B8C,
-0x02B93A2E,
-0x065A15F3,
-0x177C1A12,
-0x1100789C,
-0x3DB02031,
-0x54160785,
-0x77250A74,
-0x091B1715,
-0x799E7A0C,
-0x5A05780C,
-0x5A4D3F42,
-0x4F21462B,
-0x750F15FC,
-0x3EAF75A2,
-0x0B6C1F0E,
-0x1A394B3E,
-0x574C2246,
-0x35B72B4F,
-0x0D7A6536,
-0x64646B5A,
-0x0BDA22BF,
-0x075E1283,
-0x2F6A6F62,
-0x6A0034B9,
-0x0DFB1646,
-0x0800549F,
-0x0FAB3B09,
-0x1947783E,
-0x24294C47,
-0x7F935C6B,
-0x0FA812EB,
-0x71CF72F9,
-0x0BA06A38,
-0x012E179F,
-0x37476C96,
-0x540927A8,
-0x13D3211D,
-0x327E685D,
-0x086C75E3,
-0x40C46832,
-0x29F31306,
-0x035046B3,
-0x42755278,
-0x08A90F2C,
-0x546D688D,
-0x550C121B,
-0x15BD0946,
-0x6BBF6956,
-0x1E6B165B,
-0x123512FC,
-0x471C220A,
-0x28E74F1D,
-0x735152A2,
-0x35ED2C29,
-0x436372CE,
-0x7D5E6E19,
-0x6A3F3AA2,
-0x436D3C5F,
-0x22E21D67,
-0x1440428E,
-0x01942826,
-0x2D8F2FCA,
-0x1CE43CF7,
-0x660240ED,
-0x4A663707,
-0x2E47417E,
-0x6B2F436A,
-0x07F52F53,
-0x040D7AA6,
-0x0E236D00,
-0x1D8706FB,
-0x6BC72F06,
-0x27986374,
-0x5BD00FBC,
-0x5D2A7FAE,
-0x0F0375FC,
-0x6354546B,
-0x13973A8F,
-0x205334D6,
-0x1A8F3856,
-0x064A6894,
-0x36D9333D,
-0x4DB95A8F,
-0x722B41DF,
-0x5BBF6881,
-0x539925F9,
-0x500F1F42,
-0x33F63F91,
-0x76B46FD2,
-0x7BF106E2,
-0x19842926,
-0x27EB390E,
-0x6D6542B3,
-0x2D992382,
-0x174343BB,
-0x1F5E3A28,
-0x04CD535A,
-0x29666450,
-0x14F23D4F,
-0x44822C5C,
-0x4C1F778B,
-0x3AC63E2D,
-0x1035747C,
-0x59E46051,
-0x284C4E16,
-0x6F4753E9,
-0x7C2A15A6,
-0x69EF475B,
-0x4F815456,
-0x3E0F47BD,
-0x74EC087F,
-0x66685CFC,
-0x34A82BB2,
-0x1F633CD0,
-0x63120D84,
-0x37F14060,
-0x62E40F1D,
-0x142308B4,
-0x0F2F0B7F,
-0x3D887DDF,
-0x49187897,
-0x1D4A14E8,
-0x25520D06,
-0x3C07087C,
-0x755F76AC,
-0x23707056,
-0x28866DF9,
-0x3DA4636A,
-0x409331F2,
-0x4E4A10D5,
-0x56513905,
-0x61717B84,
-0x69C8228E,
-0x4C2744A6,
-0x7A373525,
-0x1ADB30D2,
-0x21D075AE,
-0x097353F8,
-0x3136231E,
-0x612C1009,
-0x06B7230D,
-0x58355266,
-0x1D492B01,
-0x4F0B3C0A,
-0x0F463274,
-0x07932076,
-0x08E779AB,
-0x31F9075F,
-0x66823136,
-0x6B4B1D1A,
-0x7A830E45,
-0x09D43DC3,
-0x372C57B1,
-0x53390731,
-0x380C37C6,
-0x78551D9A,
-0x67415ED2,
-0x72D60F05,
-0x3A6D426F,
-0x20940173,
-0x4379058F,
-0x38B517CC,
-0x110C554C,
-0x7681398B,
-0x1ACA466D,
-0x16062929,
-0x354D7FB8,
-0x7E6B154A,
-0x49E43CFA,
-0x361510AA,
-0x4E0E76D7,
-0x7C7B1CC6,
-0x36B43B52,
-0x25C9334A,
-0x632A031B,
-0x14387A3D,
-0x3BE40F9C,
-0x6B280EEE,
-0x00F81DC2,
-0x5802139E,
-0x0457798B,
-0x0CD06BEA,
-0x4BCB3E54,
-0x489953FF,
-0x56B04FE0,
-0x097E3E7C,
-0x03725827,
-0x44952525,
-0x50CA55E5,
-0x3F89384E,
-0x76B707DE,
-0x67EE1902,
-0x133F40F1,
-0x446509F6,
-0x66E370E3,
-0x5B744330,
-0x5CE36DE9,
-0x2C225477,
-0x5B364AF3,
-0x14554279,
-0x164746BB,
-0x40EC4ABF,
-0x64711F90,
-0x039C7A51,
-0x4D3957E3,
-0x2A8B0328,
-0x504E378E,
-0x35AE7C58,
-0x204115E8,
-0x05E378FA,
-0x4D043889,
-0x61CD21DB,
-0x1A2452DE,
-0x6C733DE6,
-0x7CC6726B,
-0x69985551,
-0x7D6363E3,
-0x6BD85B8A,
-0x79435CEA,
-0x48870BE0,
-0x7FBB76A4,
-0x6D4964F2,
-0x47264505,
-0x73716ED8,
-0x75A416D8,
-0x0D1B3813,
-0x39952A8C,
-0x28083535,
-0x6DD463C1,
-0x623C6F4F,
-0x45B34D96,
-0x2C592D1F,
-0x3CBB75B1,
-0x35B902F6,
-0x46206C0B,
-0x7E4E756B,
-0x78067381,
-0x2A3B1AC2,
-0x2E762F1A,
-0x732E6719,
-0x621F5819,
-0x53840F58,
-0x2ECC48C2,
-0x471A2ED6,
-0x45A967ED,
-0x3DF41BCC,
-0x4735414C,
-0x1C90167A,
-0x4106567B
-#else   // it is a 16-bit hosted linker
-0x1DE8,
-0x2EE1,
-0x6E21,
-0x134B,
-0x0F40,
-0x6D5B,
-0x0767,
-0x1454,
-0x3FE5,
-0x30A8,
-0x05D0,
-0x3ED8,
-0x6306,
-0x0B8C,
-0x02B9,
-0x3A2E,
-0x065A,
-0x15F3,
-0x177C,
-0x1A12,
-0x1100,
-0x789C,
-0x3DB0,
-0x2031,
-0x5416,
-0x0785,
-0x7725,
-0x0A74,
-0x091B,
-0x1715,
-0x799E,
-0x7A0C,
-0x5A05,
-0x780C,
-0x5A4D,
-0x3F42,
-0x4F21,
-0x462B,
-0x750F,
-0x15FC,
-0x3EAF,
-0x75A2,
-0x0B6C,
-0x1F0E,
-0x1A39,
-0x4B3E,
-0x574C,
-0x2246,
-0x35B7,
-0x2B4F,
-0x0D7A,
-0x6536,
-0x6464,
-0x6B5A,
-0x0BDA,
-0x22BF,
-0x075E,
-0x1283,
-0x2F6A,
-0x6F62,
-0x6A00,
-0x34B9,
-0x0DFB,
-0x1646,
-0x0800,
-0x549F,
-0x0FAB,
-0x3B09,
-0x1947,
-0x783E,
-0x2429,
-0x4C47,
-0x7F93,
-0x5C6B,
-0x0FA8,
-0x12EB,
-0x71CF,
-0x72F9,
-0x0BA0,
-0x6A38,
-0x012E,
-0x179F,
-0x3747,
-0x6C96,
-0x5409,
-0x27A8,
-0x13D3,
-0x211D,
-0x327E,
-0x685D,
-0x086C,
-0x75E3,
-0x40C4,
-0x6832,
-0x29F3,
-0x1306,
-0x0350,
-0x46B3,
-0x4275,
-0x5278,
-0x08A9,
-0x0F2C,
-0x546D,
-0x688D,
-0x550C,
-0x121B,
-0x15BD,
-0x0946,
-0x6BBF,
-0x6956,
-0x1E6B,
-0x165B,
-0x1235,
-0x12FC,
-0x471C,
-0x220A,
-0x28E7,
-0x4F1D,
-0x7351,
-0x52A2,
-0x35ED,
-0x2C29,
-0x4363,
-0x72CE,
-0x7D5E,
-0x6E19,
-0x6A3F,
-0x3AA2,
-0x436D,
-0x3C5F,
-0x22E2,
-0x1D67,
-0x1440,
-0x428E,
-0x0194,
-0x2826,
-0x2D8F,
-0x2FCA,
-0x1CE4,
-0x3CF7,
-0x6602,
-0x40ED,
-0x4A66,
-0x3707,
-0x2E47,
-0x417E,
-0x6B2F,
-0x436A,
-0x07F5,
-0x2F53,
-0x040D,
-0x7AA6,
-0x0E23,
-0x6D00,
-0x1D87,
-0x06FB,
-0x6BC7,
-0x2F06,
-0x2798,
-0x6374,
-0x5BD0,
-0x0FBC,
-0x5D2A,
-0x7FAE,
-0x0F03,
-0x75FC,
-0x6354,
-0x546B,
-0x1397,
-0x3A8F,
-0x2053,
-0x34D6,
-0x1A8F,
-0x3856,
-0x064A,
-0x6894,
-0x36D9,
-0x333D,
-0x4DB9,
-0x5A8F,
-0x722B,
-0x41DF,
-0x5BBF,
-0x6881,
-0x5399,
-0x25F9,
-0x500F,
-0x1F42,
-0x33F6,
-0x3F91,
-0x76B4,
-0x6FD2,
-0x7BF1,
-0x06E2,
-0x1984,
-0x2926,
-0x27EB,
-0x390E,
-0x6D65,
-0x42B3,
-0x2D99,
-0x2382,
-0x1743,
-0x43BB,
-0x1F5E,
-0x3A28,
-0x04CD,
-0x535A,
-0x2966,
-0x6450,
-0x14F2,
-0x3D4F,
-0x4482,
-0x2C5C,
-0x4C1F,
-0x778B,
-0x3AC6,
-0x3E2D,
-0x1035,
-0x747C,
-0x59E4,
-0x6051,
-0x284C,
-0x4E16,
-0x6F47,
-0x53E9,
-0x7C2A,
-0x15A6,
-0x69EF,
-0x475B,
-0x4F81,
-0x5456,
-0x3E0F,
-0x47BD,
-0x74EC,
-0x087F,
-0x6668,
-0x5CFC,
-0x34A8,
-0x2BB2,
-0x1F63,
-0x3CD0,
-0x6312,
-0x0D84,
-0x37F1,
-0x4060,
-0x62E4,
-0x0F1D,
-0x1423,
-0x08B4,
-0x0F2F,
-0x0B7F,
-0x3D88,
-0x7DDF,
-0x4918,
-0x7897
-#endif
-};
+static sym_table    GlobalSyms;
+static sym_table    StaticSyms;
+
+static unsigned_32  GlobalHashFn( char *, unsigned );
+static unsigned_32  StaticHashFn( char *, unsigned );
+static void         SetSymAlias( symbol *sym, char *target, unsigned targetlen );
 
 void ResetSym( void )
 /**************************/
@@ -605,50 +110,118 @@ void ResetSym( void )
     ClearHashPointers();
 }
 
+static void SetTableSize( sym_table *tab, unsigned size )
+/*******************************************************/
+/* allocate an empty table of the given size */
+{
+    unsigned    shift;
+
+    _ChkAlloc( tab->slots, size * sizeof( sym_slot ) );
+    memset( tab->slots, 0, size * sizeof( sym_slot ) );
+    tab->size = size;
+    for( shift = 32; size > 1; size >>= 1 ) {
+        shift--;
+    }
+    tab->shift = shift;
+    tab->used = 0;
+}
+
+static void InsertSlot( sym_table *tab, symbol *sym, unsigned_32 hash,
+                        unsigned len )
+/********************************************************************/
+/* put sym in the first free slot for hash; there must be one */
+{
+    unsigned    mask;
+    unsigned    index;
+    sym_slot    *slot;
+
+    mask = tab->size - 1;
+    index = FIRST_SLOT( tab, hash );
+    while( tab->slots[ index ].sym != NULL ) {
+        index = (index + 1) & mask;
+    }
+    slot = &tab->slots[ index ];
+    slot->sym = sym;
+    slot->hash = hash;
+    slot->len = len;
+    tab->used++;
+}
+
+static void RehashTable( sym_table *tab, unsigned size, bool purge )
+/******************************************************************/
+/* move the symbols to a new table of the given size, leaving out the ones
+ * which have been killed if purge is set. The hash values are kept in the
+ * slots, so the names don't have to be looked at again. */
+{
+    sym_slot    *old;
+    sym_slot    *slot;
+    unsigned    count;
+
+    old = tab->slots;
+    count = tab->size;
+    SetTableSize( tab, size );
+    for( slot = old; count > 0; slot++, count-- ) {
+        if( slot->sym == NULL )
+            continue;
+        if( !purge || !(slot->sym->info & SYM_KILL) ) {
+            InsertSlot( tab, slot->sym, slot->hash, slot->len );
+        }
+    }
+    _LnkFree( old );
+}
+
+static void AddToTable( sym_table *tab, symbol *sym, unsigned_32 hash )
+/*********************************************************************/
+{
+    if( (tab->used + 1) * 2 > tab->size ) {
+        RehashTable( tab, tab->size * 2, FALSE );
+#ifdef _INT_DEBUG
+        tab->grown++;
+#endif
+    }
+    InsertSlot( tab, sym, hash, sym->namelen_cmp );
+}
+
 void InitSym( void )
 /*************************/
 {
-    _ChkAlloc( GlobalSymPtrs, GLOBAL_TABALLOC );
-    _ChkAlloc( StaticSymPtrs, STATIC_TABALLOC );
+    SetTableSize( &GlobalSyms, GLOBAL_TABSIZE );
+    SetTableSize( &StaticSyms, STATIC_TABSIZE );
 }
 
 #ifdef _INT_DEBUG
 
-static void DumpTable( symbol **table, unsigned tabsize )
-/*******************************************************/
+static void DumpTable( sym_table *tab )
+/*************************************/
 {
-    unsigned    mask;
-    unsigned    min;
-    unsigned    max;
-    unsigned    val;
-    unsigned_32 numsyms;
     unsigned    index;
-    symbol      *sym;
-
-    numsyms = 0;
-    min = 0xFFFF;
-    max = 0;
-    for( index = 0; index < tabsize; index++ ) {
-        mask = DBG_ALWAYS;
-        if( index % 15 != 14 ) {
-            mask |= DBG_NOCRLF;
-        }
-        val = 0;
-        for( sym = table[ index ]; sym != NULL; sym = sym->hash ) {
-            val++;
-        }
-        DEBUG(( mask, "%x ", val ));
-        if( val > max ) {
-            max = val;
-        }
-        if( val < min ) {
-            min = val;
+    unsigned    run;
+    unsigned    maxrun;
+    unsigned    runs;
+
+    run = 0;
+    maxrun = 0;
+    runs = 0;
+    for( index = 0; index < tab->size; index++ ) {
+        if( tab->slots[ index ].sym != NULL ) {
+            run++;
+            if( run > maxrun ) {
+                maxrun = run;
+            }
+        } else if( run != 0 ) {
+            runs++;
+            run = 0;
         }
-        numsyms += val;
     }
-    DEBUG(( DBG_ALWAYS, "" ));  // put out a blank line.
-    DEBUG(( DBG_ALWAYS, "# of syms: %l, max height %d, min height %d",
-            numsyms, max, min ));
+    if( run != 0 ) {
+        runs++;
+    }
+    DEBUG(( DBG_ALWAYS, "# of syms: %d, table size %d, doubled %d times",
+            tab->used, tab->size, tab->grown ));
+    DEBUG(( DBG_ALWAYS, "# of clusters: %d, longest cluster %d",
+            runs, maxrun ));
+    DEBUG(( DBG_ALWAYS, "# of searches: %l, slots probed %l",
+            tab->searches, tab->probes ));
 }
 
 static void DumpHashTable( void )
@@ -656,8 +229,8 @@ static void DumpHashTable( void )
 {
     if( LinkState & INTERNAL_DEBUG ) {
         DEBUG(( DBG_ALWAYS, "symbol table load" ));
-        DumpTable( GlobalSymPtrs, GLOBAL_TABSIZE );
-        DumpTable( StaticSymPtrs, STATIC_TABSIZE );
+        DumpTable( &GlobalSyms );
+        DumpTable( &StaticSyms );
     }
 }
 #endif
@@ -711,53 +284,78 @@ void CleanSym( void )
 void FiniSym( void )
 /*************************/
 {
-    _LnkFree( GlobalSymPtrs );
-    _LnkFree( StaticSymPtrs );
+    _LnkFree( GlobalSyms.slots );
+    _LnkFree( StaticSyms.slots );
 }
 
-static void PrepHashTable( symbol **table, unsigned size )
-/********************************************************/
+static void PrepHashTable( void *cookie, sym_table *tab )
+/*******************************************************/
 {
-    while( size > 0 ) {
-        *table = CarveGetIndex( CarveSymbol, *table );
-        table++;
-        size--;
+    sym_slot    *slot;
+    unsigned    count;
+    unsigned_32 size;
+
+    for( slot = tab->slots, count = tab->size; count > 0; slot++, count-- ) {
+        slot->sym = CarveGetIndex( CarveSymbol, slot->sym );
     }
+    size = tab->size;
+    WritePermFile( cookie, &size, sizeof( unsigned_32 ) );
+    WritePermFile( cookie, tab->slots, tab->size * sizeof( sym_slot ) );
 }
 
 void WriteHashPointers( void *cookie )
 /*******************************************/
 {
-    PrepHashTable( StaticSymPtrs, STATIC_TABSIZE );
-    WritePermFile( cookie, StaticSymPtrs, STATIC_TABALLOC );
-    PrepHashTable( GlobalSymPtrs, GLOBAL_TABSIZE );
-    WritePermFile( cookie, GlobalSymPtrs, GLOBAL_TABALLOC );
+    PrepHashTable( cookie, &StaticSyms );
+    PrepHashTable( cookie, &GlobalSyms );
 }
 
-static void RebuildHashTable( symbol **table, unsigned size )
-/***********************************************************/
+static void RebuildHashTable( void *cookie, sym_table *tab )
+/**********************************************************/
 {
-    while( size > 0 ) {
-        *table = CarveMapIndex( CarveSymbol, *table );
-        table++;
-        size--;
+    sym_slot    *slot;
+    unsigned    count;
+    unsigned_32 size;
+
+    ReadPermFile( cookie, &size, sizeof( unsigned_32 ) );
+    if( size != tab->size ) {
+        _LnkFree( tab->slots );
+        SetTableSize( tab, size );
+    }
+    ReadPermFile( cookie, tab->slots, tab->size * sizeof( sym_slot ) );
+    tab->used = 0;
+    for( slot = tab->slots, count = tab->size; count > 0; slot++, count-- ) {
+        slot->sym = CarveMapIndex( CarveSymbol, slot->sym );
+        if( slot->sym != NULL ) {
+            tab->used++;
+        }
     }
 }
 
 void ReadHashPointers( void *cookie )
 /******************************************/
 {
-    ReadPermFile( cookie, StaticSymPtrs, STATIC_TABALLOC );
-    ReadPermFile( cookie, GlobalSymPtrs, GLOBAL_TABALLOC );
-    RebuildHashTable( StaticSymPtrs, STATIC_TABSIZE );
-    RebuildHashTable( GlobalSymPtrs, GLOBAL_TABSIZE );
+    RebuildHashTable( cookie, &StaticSyms );
+    RebuildHashTable( cookie, &GlobalSyms );
+}
+
+static void ClearTable( sym_table *tab )
+/**************************************/
+{
+    memset( tab->slots, 0, tab->size * sizeof( sym_slot ) );
+    tab->used = 0;
+#ifdef _INT_DEBUG
+    tab->searches = 0;
+    tab->probes = 0;
+    tab->grown = 0;
+#endif
 }
 
 void ClearHashPointers( void )
 /***********************************/
 {
-    memset( GlobalSymPtrs, 0, GLOBAL_TABSIZE * sizeof(symbol *) );
-    memset( StaticSymPtrs, 0, STATIC_TABSIZE * sizeof(symbol *) );
+    ClearTable( &GlobalSyms );
+    ClearTable( &StaticSyms );
 }
 
 void SetSymCase( void )
@@ -936,40 +534,63 @@ static void SetSymAlias( symbol *sym, char *target, unsigned targetlen )
     sym->info &= ~SYM_WAS_LAZY;
 }
 
-static symbol *GlobalSearchSym( char *symname, unsigned hash, unsigned len )
-/**************************************************************************/
-/* search through the given chain for the given name */
+static symbol *GlobalSearchSym( char *symname, unsigned_32 hash, unsigned len )
+/*****************************************************************************/
+/* probe the global table for the given name */
 {
-    symbol      *sym;
+    sym_slot    *slots;
+    unsigned    mask;
+    unsigned    index;
 
-    for( sym = GlobalSymPtrs[ hash ]; sym != NULL; sym = sym->hash ) {
-        if( len == sym->namelen_cmp && (*CmpRtn)( symname, sym->name, len ) == 0 ) {
-            break;
+    slots = GlobalSyms.slots;
+    mask = GlobalSyms.size - 1;
+#ifdef _INT_DEBUG
+    GlobalSyms.searches++;
+#endif
+    for( index = FIRST_SLOT( &GlobalSyms, hash ); slots[ index ].sym != NULL;
+                                            index = (index + 1) & mask ) {
+#ifdef _INT_DEBUG
+        GlobalSyms.probes++;
+#endif
+        if( slots[ index ].hash == hash && slots[ index ].len == len
+                && (*CmpRtn)( symname, slots[ index ].sym->name, len ) == 0 ) {
+            return( slots[ index ].sym );
         }
     }
-    return( sym );
+    return( NULL );
 }
 
-static symbol *StaticSearchSym( char *symname, unsigned hash, unsigned len )
-/**************************************************************************/
-/* search through the given chain for the given name */
+static symbol *StaticSearchSym( char *symname, unsigned_32 hash, unsigned len )
+/*****************************************************************************/
+/* probe the static table for the given name in the current module */
 {
-    symbol      *sym;
+    sym_slot    *slots;
+    unsigned    mask;
+    unsigned    index;
 
-    for( sym = StaticSymPtrs[ hash ]; sym != NULL; sym = sym->hash ) {
-        if( sym->info & SYM_IN_CURRENT ) {
-            if( len == sym->namelen_cmp && memcmp( symname, sym->name, len ) == 0 ) {
-                break;
-            }
+    slots = StaticSyms.slots;
+    mask = StaticSyms.size - 1;
+#ifdef _INT_DEBUG
+    StaticSyms.searches++;
+#endif
+    for( index = FIRST_SLOT( &StaticSyms, hash ); slots[ index ].sym != NULL;
+                                            index = (index + 1) & mask ) {
+#ifdef _INT_DEBUG
+        StaticSyms.probes++;
+#endif
+        if( slots[ index ].hash == hash && slots[ index ].len == len
+                && (slots[ index ].sym->info & SYM_IN_CURRENT)
+                && memcmp( symname, slots[ index ].sym->name, len ) == 0 ) {
+            return( slots[ index ].sym );
         }
     }
-    return( sym );
+    return( NULL );
 }
 
 static symbol *DoSymOp( sym_flags op, char *symname, unsigned length )
 /********************************************************************/
 {
-    unsigned    hash;
+    unsigned_32 hash;
     symbol      *sym;
     unsigned    searchlen;
 #ifdef _INT_DEBUG
@@ -997,7 +618,7 @@ static symbol *DoSymOp( sym_flags op, char *symname, unsigned length )
         hash = GlobalHashFn( symname, searchlen );
         sym = GlobalSearchSym( symname, hash, searchlen );
     }
-    DEBUG(( DBG_OLD, "- hash %d", hash ));
+    DEBUG(( DBG_OLD, "- hash %l", hash ));
     if( sym != NULL ) {
         DEBUG(( DBG_OLD, "found symbol %s", symname_dbg ));
         DEBUG(( DBG_OLD, " - handle = %h", sym ));
@@ -1010,11 +631,9 @@ static symbol *DoSymOp( sym_flags op, char *symname, unsigned length )
 
         if( op & ST_STATIC ) {
             sym->info |= SYM_STATIC;
-            sym->hash = StaticSymPtrs[hash];
-            StaticSymPtrs[hash] = sym;
+            AddToTable( &StaticSyms, sym, hash );
         } else {
-            sym->hash = GlobalSymPtrs[hash];
-            GlobalSymPtrs[hash] = sym;
+            AddToTable( &GlobalSyms, sym, hash );
         }
         DEBUG((DBG_OLD, "added symbol %s", symname_dbg ));
     }
@@ -1060,36 +679,34 @@ symbol *SymOp( sym_flags op, char *symname, unsigned length )
     return( sym );
 }
 
-static unsigned StaticHashFn( char *name, unsigned len )
-/******************************************************/
+static unsigned_32 StaticHashFn( char *name, unsigned len )
+/*********************************************************/
+/* statics of different modules are spread out by mixing in the module time */
 {
-    unsigned    value;
-    unsigned    modval;
+    unsigned_32 value;
 
-    modval = CurrMod->modtime;
-    value = ScatterTable[ modval & 0xff ];
-    modval >>= 8;
-    value = value ^ ScatterTable[ modval & 0xff ];
+    value = (HASH_SEED ^ (unsigned_32)CurrMod->modtime) * HASH_PRIME;
     while( len > 0 ) {
-        value = (value << 1) ^ ScatterTable[ *(unsigned char *)name ];
+        value = (value ^ *(unsigned char *)name) * HASH_PRIME;
         ++name;
         len--;
     }
-    return( value % STATIC_TABSIZE );
+    return( value );
 }
 
-static unsigned GlobalHashFn( char *name, unsigned len )
-/******************************************************/
+static unsigned_32 GlobalHashFn( char *name, unsigned len )
+/*********************************************************/
+/* the name is folded to lower case, since the search may be caseless */
 {
-    unsigned    value;
+    unsigned_32 value;
 
-    value = 0;
+    value = HASH_SEED;
     while( len > 0 ) {
-        value = (value << 1) ^ ScatterTable[ *(unsigned char *)name | 0x20 ];
+        value = (value ^ (*(unsigned char *)name | 0x20)) * HASH_PRIME;
         ++name;
         len--;
     }
-    return( value % GLOBAL_TABSIZE );
+    return( value );
 }
 
 void ReportMultiple( symbol *sym, char *name, unsigned len )
@@ -1316,64 +933,34 @@ static void UndefSymbol( symbol *sym )
     sym->mod = NULL;
 }
 
-static void PurgeHashTable( symbol **curr )
-/*****************************************/
+static void PurgeHashTable( sym_table *tab )
+/******************************************/
 {
-    while( *curr != NULL ) {
-        CleanAltDefs( *curr );
-        if( (*curr)->info & SYM_KILL ) {
-            if( (*curr)->info & SYM_RELOC_REFD ) {
-                UndefSymbol( *curr );
-                curr = &(*curr)->hash;
-            } else {
-                *curr = (*curr)->hash;
+    sym_slot    *slot;
+    unsigned    count;
+
+    for( slot = tab->slots, count = tab->size; count > 0; slot++, count-- ) {
+        if( slot->sym != NULL ) {
+            CleanAltDefs( slot->sym );
+            if( (slot->sym->info & SYM_KILL) && (slot->sym->info & SYM_RELOC_REFD) ) {
+                UndefSymbol( slot->sym );
             }
-        } else {
-            curr = &(*curr)->hash;
-        }
-    }
-}
-
-static void CleanupOldAltdefs( symbol **curr )
-/********************************************/
-/* some symbols may have been marked SYM_KILL during PurgeHashTable. Make
- * sure these are gone */
-{
-    while( *curr != NULL ) {
-        if( (*curr)->info & SYM_KILL ) {
-            *curr = (*curr)->hash;
-        } else {
-            curr = &(*curr)->hash;
         }
     }
 }
 
-static void WalkAHashTable( void (*fn)(symbol **), symbol **symtab,
-                                unsigned size )
-/*****************************************************************/
-{
-    while( size > 0 ) {
-        fn( symtab );
-        symtab++;
-        size--;
-    }
-}
-
-static void WalkHashTables( void (*fn)(symbol **) )
-/***************************************************/
-{
-    WalkAHashTable( fn, GlobalSymPtrs, GLOBAL_TABSIZE );
-    WalkAHashTable( fn, StaticSymPtrs, STATIC_TABSIZE );
-}
-
 void PurgeSymbols( void )
 /******************************/
 {
     symbol **   list;
     symbol *    sym;
 
-    WalkHashTables( PurgeHashTable );
-    WalkHashTables( CleanupOldAltdefs );
+    PurgeHashTable( &GlobalSyms );
+    PurgeHashTable( &StaticSyms );
+    /* some symbols may have been marked SYM_KILL by CleanAltDefs. Rebuild
+     * the tables without the killed ones, since an empty slot ends a search */
+    RehashTable( &GlobalSyms, GlobalSyms.size, TRUE );
+    RehashTable( &StaticSyms, StaticSyms.size, TRUE );
     list = &HeadSym;
     while( *list != NULL ) {
         sym = *list;
@@ -65,6 +65,72 @@ static unsigned NumCacheBlocks( unsigned long len )
     return( numblocks );
 }
 
+void CacheReadAhead( file_list *list )
+/*******************************************/
+// start reading the object files which follow list into memory in
+// separate threads, so that they are read while pass 1 is busy with list.
+// Pass 1 still gets the files one at a time in the original order, so the
+// result is the same as when they are read by CacheOpen.
+{
+    infilelist          *file;
+    unsigned            depth;
+    enum infile_flags   flags;
+    char                *prefix;
+
+    if( ReadAheadFiles == 0 || (LinkFlags & NOCACHE_FLAG) )
+        return;
+    depth = 0;
+    for( list = list->next_file; list != NULL; list = list->next_file ) {
+        if( depth++ >= ReadAheadFiles )
+            break;
+        file = list->file;
+        if( file->readahead != NULL || file->cache != NULL )
+            continue;
+        if( file->flags & (INSTAT_LIBRARY | INSTAT_IOERR | INSTAT_PAGE_CACHE) )
+            continue;
+        flags = file->flags;            // CacheOpen will complain if it
+        prefix = file->prefix;          // can't be opened.
+        file->flags |= INSTAT_NO_WARNING;
+        if( !DoObjOpen( file ) ) {
+            file->flags = flags;
+            file->prefix = prefix;
+            continue;
+        }
+        file->flags = flags;
+        if( file->len == 0 ) {
+            file->len = QFileSize( file->handle );
+            if( file->len == 0 ) {
+                continue;
+            }
+        }
+        if( file->currpos != 0 ) {
+            QLSeek( file->handle, 0, SEEK_SET, file->name );
+            file->currpos = 0;
+        }
+        _ChkAlloc( file->cache, file->len );
+        file->readahead = QReadAhead( file->handle, file->cache, file->len );
+        if( file->readahead == NULL ) {         // no threads for us
+            _LnkFree( file->cache );
+            file->cache = NULL;
+            ReadAheadFiles = 0;
+            break;
+        }
+        file->flags |= INSTAT_FULL_CACHE | INSTAT_IN_USE;
+    }
+}
+
+static void ReadAheadDone( infilelist *file )
+/*******************************************/
+// wait for the read ahead of file to finish
+{
+    if( !QReadAheadWait( file->readahead ) ) {
+        _LnkFree( file->cache );        // read it again to report the error
+        file->cache = NULL;
+    }
+    file->readahead = NULL;
+    file->currpos = file->len;
+}
+
 bool CacheOpen( file_list *list )
 /**************************************/
 {
@@ -75,6 +141,8 @@ bool CacheOpen( file_list *list )
     if( list == NULL )
         return( TRUE );
     file = list->file;
+    if( file->readahead != NULL )
+        ReadAheadDone( file );
     if( file->flags & INSTAT_IOERR )
         return( FALSE );
     if( DoObjOpen( file ) ) {
@@ -104,6 +172,15 @@ bool CacheOpen( file_list *list )
             }
         }
     }
+    if( file->cache == NULL && !(LinkFlags & NOCACHE_FLAG) ) {
+        // where the host can map the file, CacheRead hands out pointers
+        // straight into the mapping and nothing is copied to the heap.
+        file->cache = QMapFile( file->handle, file->len );
+        if( file->cache != NULL ) {
+            file->flags &= ~INSTAT_PAGE_CACHE;
+            file->flags |= INSTAT_FULL_CACHE | INSTAT_MAPPED;
+        }
+    }
     if( file->cache == NULL ) {
         if( file->flags & INSTAT_FULL_CACHE ) {
             _ChkAlloc( file->cache, file->len );
@@ -149,6 +226,8 @@ void CacheClose( file_list *list, unsigned pass )
         }
         break;
     case 3: /* freeing structure */
+        if( file->readahead != NULL )
+            ReadAheadDone( file );
         FreeObjCache( list );
         if( file->handle != NIL_HANDLE ) {
             QClose( file->handle, file->name );
@@ -307,7 +386,12 @@ void FreeObjCache( file_list *list )
 {
     if( list == NULL )
         return;
-    if( list->file->flags & INSTAT_FULL_CACHE ) {
+    if( list->file->flags & INSTAT_MAPPED ) {
+        if( list->file->cache != NULL ) {
+            QUnmapFile( list->file->cache, list->file->len );
+        }
+        list->file->flags &= ~INSTAT_MAPPED;
+    } else if( list->file->flags & INSTAT_FULL_CACHE ) {
         _LnkFree( list->file->cache );
     } else {
         DumpFileCache( list->file, TRUE );
@@ -43,6 +43,14 @@
 #if defined( __OS2__ ) && defined(__386__)
 #include <malloc.h>
 #endif
+#if defined( __NT__ )
+#include <io.h>
+#include <windows.h>
+#elif defined( __OS2__ ) && defined( __386__ )
+#define INCL_DOSPROCESS
+#define INCL_DOSFILEMGR
+#include <os2.h>
+#endif
 
 #include "linkstd.h"
 #include "msg.h"
@@ -316,6 +324,16 @@ unsigned long QPos( f_handle file )
     return( lseek( file, 0L, SEEK_CUR ) );
 }
 
+bool QTruncate( f_handle file, char *name )
+/************************************************/
+/* cut the file off at the current position */
+{
+    if( chsize( file, lseek( file, 0L, SEEK_CUR ) ) == 0 )
+        return( TRUE );
+    LnkMsg( ERR+MSG_IO_PROBLEM, "12", name, strerror( errno ) );
+    return( FALSE );
+}
+
 unsigned long QFileSize( f_handle file )
 /*********************************************/
 {
@@ -477,3 +495,141 @@ void GetCmdLine( char *buff )
 {
     getcmd( buff );
 }
+
+#if defined( __NT__ ) || defined( __OS2__ ) && defined( __386__ )
+
+/* a file being read by a separate thread (see QReadAhead) */
+typedef struct {
+#if defined( __NT__ )
+    HANDLE          thread;
+    HANDLE          file;
+#else
+    TID             thread;
+    HFILE           file;
+#endif
+    void            *buffer;
+    unsigned long   len;
+    bool            ok;
+} read_ahead;
+
+/* the thread only talks to the operating system, not to the C library */
+#ifdef __WATCOMC__
+#pragma off(check_stack);
+#endif
+
+#if defined( __NT__ )
+static DWORD WINAPI ReadAheadThread( LPVOID parm )
+/************************************************/
+{
+    read_ahead      *ra = parm;
+    char            *dest;
+    unsigned long   left;
+    DWORD           amt;
+
+    dest = ra->buffer;
+    for( left = ra->len; left > 0; left -= amt ) {
+        if( !ReadFile( ra->file, dest, left, &amt, NULL ) || amt == 0 ) {
+            return( 0 );
+        }
+        dest += amt;
+    }
+    ra->ok = TRUE;
+    return( 0 );
+}
+#else
+static void APIENTRY ReadAheadThread( ULONG parm )
+/************************************************/
+{
+    read_ahead      *ra = (read_ahead *)parm;
+    char            *dest;
+    unsigned long   left;
+    ULONG           amt;
+
+    dest = ra->buffer;
+    for( left = ra->len; left > 0; left -= amt ) {
+        if( DosRead( ra->file, dest, left, &amt ) != 0 || amt == 0 ) {
+            return;
+        }
+        dest += amt;
+    }
+    ra->ok = TRUE;
+}
+#endif
+
+void *QReadAhead( f_handle file, void *buffer, unsigned long len )
+/***********************************************************************/
+/* start reading len bytes from the current position of file into buffer
+ * in a separate thread. Returns NULL if no thread could be started. */
+{
+    read_ahead  *ra;
+
+    _ChkAlloc( ra, sizeof( read_ahead ) );
+#if defined( __NT__ )
+    ra->file = (HANDLE)_get_osfhandle( file );
+#else
+    ra->file = file;
+#endif
+    ra->buffer = buffer;
+    ra->len = len;
+    ra->ok = FALSE;
+#if defined( __NT__ )
+    ra->thread = CreateThread( NULL, 0, ReadAheadThread, ra, 0, NULL );
+    if( ra->thread != NULL )
+        return( ra );
+#else
+    if( DosCreateThread( &ra->thread, ReadAheadThread, (ULONG)ra, 0, 8192 ) == 0 )
+        return( ra );
+#endif
+    _LnkFree( ra );
+    return( NULL );
+}
+
+bool QReadAheadWait( void *req )
+/*************************************/
+/* wait for a QReadAhead to finish, TRUE if all the bytes were read */
+{
+    read_ahead  *ra = req;
+    bool        ok;
+
+#if defined( __NT__ )
+    WaitForSingleObject( ra->thread, INFINITE );
+    CloseHandle( ra->thread );
+#else
+    DosWaitThread( &ra->thread, DCWW_WAIT );
+#endif
+    ok = ra->ok;
+    _LnkFree( ra );
+    return( ok );
+}
+
+#else
+
+void *QReadAhead( f_handle file, void *buffer, unsigned long len )
+/***********************************************************************/
+{
+    file = file; buffer = buffer; len = len;
+    return( NULL );
+}
+
+bool QReadAheadWait( void *req )
+/*************************************/
+{
+    req = req;
+    return( FALSE );
+}
+
+#endif
+
+void *QMapFile( f_handle file, unsigned long len )
+/*******************************************************/
+/* no memory mapped files here, the caller has to read the file itself */
+{
+    file = file; len = len;
+    return( NULL );
+}
+
+void QUnmapFile( void *addr, unsigned long len )
+/*****************************************************/
+{
+    addr = addr; len = len;
+}
@@ -54,12 +54,14 @@ typedef struct {
 
 infilelist *    CachedLibFiles;
 infilelist *    CachedFiles;
+unsigned        ReadAheadFiles;
 
 void ResetObjIO( void )
 /****************************/
 {
     CachedFiles = NULL;
     CachedLibFiles = NULL;
+    ReadAheadFiles = 0;
 }
 
 static infilelist * AllocEntry( char *name, path_entry *path )
@@ -73,6 +75,7 @@ static infilelist * AllocEntry( char *name, path_entry *path )
     entry->prefix = NULL;
     entry->handle = NIL_HANDLE;
     entry->cache = NULL;
+    entry->readahead = NULL;
     entry->len = 0;
     entry->flags = 0;
     return entry;
@@ -60,6 +60,22 @@
 
 static seg_leader       *LastCodeSeg;    // last code segment in current module
 
+/* incremental PE and ELF links leave room after the code of each module, so
+ * that a module which grows a little can be relinked without moving the
+ * rest of the executable. */
+#define INC_CODE_ROOM( len )    ROUND_UP( (len) + (len) / 8, 16 )
+
+typedef struct inc_seg_room {
+    struct inc_seg_room *next;
+    mod_entry           *mod;
+    char                *segname;
+    char                *clname;
+    offset              length;
+} inc_seg_room;
+
+static inc_seg_room     *IncSegRoom;    // room held by the changed modules
+static inc_seg_room     **IncSegRoomTail = &IncSegRoom;
+
 static seg_leader   *MakeNewLeader( segdata *sdata, class_entry *class, unsigned_16 info );
 static seg_leader   *FindALeader( segdata *sdata, class_entry *class, unsigned_16 info );
 static void         DoAllocateSegment( segdata *sdata, char *clname );
@@ -412,12 +428,110 @@ void AllocateSegment( segnode *newseg, char *clname )
     newseg->info = newseg->entry->u.leader->info;
 }
 
+static bool CanPadSegment( segdata *sdata, class_entry *class )
+/*************************************************************/
+{
+    if( !(LinkFlags & INC_LINK_FLAG) || !(FmtData.type & (MK_PE | MK_ELF)) )
+        return( FALSE );
+    if( (LinkState & HAVE_MACHTYPE_MASK) != HAVE_I86_CODE )
+        return( FALSE );
+    if( CurrMod == NULL || IS_FMT_INCREMENTAL( CurrMod->modinfo ) )
+        return( FALSE );                // already padded
+    if( CurrMod->f.source == NULL
+        || (CurrMod->f.source->file->flags & INSTAT_LIBRARY) )
+        return( FALSE );                // libraries hardly ever change
+    if( !(class->flags & CLASS_CODE) || DBIColSeg( class ) != NOT_DEBUGGING_INFO )
+        return( FALSE );
+    return( !sdata->isdead && !sdata->isuninit && !sdata->iscdat
+                                                    && !sdata->isabs );
+}
+
+static offset IncSegLength( segdata *sdata, char *clname )
+/********************************************************/
+// if the previous version of the module had room enough for the new code
+// keep that size, so everything after it stays where it was.
+{
+    inc_seg_room    *room;
+    inc_seg_room    **prev;
+
+    for( prev = &IncSegRoom; (room = *prev) != NULL; prev = &room->next ) {
+        if( room->mod == CurrMod && strcmp( room->segname, sdata->u.name ) == 0
+                                 && stricmp( room->clname, clname ) == 0 ) {
+            *prev = room->next;
+            if( IncSegRoomTail == &room->next ) {
+                IncSegRoomTail = prev;
+            }
+            if( room->length >= sdata->length ) {
+                sdata->length = room->length;
+            } else {
+                sdata->length = INC_CODE_ROOM( sdata->length );
+            }
+            _LnkFree( room );
+            return( sdata->length );
+        }
+    }
+    return( INC_CODE_ROOM( sdata->length ) );
+}
+
+static void PadCode( virt_mem stg, offset len )
+/*********************************************/
+// fill the room after the code with nops, since some code segments (.init)
+// are meant to fall through into the next module's piece.
+{
+    unsigned_8  nops[16];
+    unsigned    amt;
+
+    memset( nops, 0x90, sizeof( nops ) );
+    while( len > 0 ) {
+        amt = ( len > sizeof( nops ) ) ? sizeof( nops ) : len;
+        PutInfo( stg, nops, amt );
+        stg += amt;
+        len -= amt;
+    }
+}
+
+void IncSaveSegRoom( mod_entry *mod )
+/******************************************/
+// remember the code sizes of a module which is about to be read again
+{
+    segdata         *sdata;
+    inc_seg_room    *room;
+
+    if( !(FmtData.type & (MK_PE | MK_ELF)) )
+        return;
+    for( sdata = NULL; (sdata = Ring2Step( mod->segs, sdata )) != NULL; ) {
+        if( sdata->isdead || sdata->isuninit || sdata->iscdat )
+            continue;
+        _ChkAlloc( room, sizeof( inc_seg_room ) );
+        room->mod = mod;
+        room->segname = sdata->u.name;
+        room->clname = sdata->o.clname;
+        room->length = sdata->length;
+        room->next = NULL;
+        *IncSegRoomTail = room;         // keep the segment order
+        IncSegRoomTail = &room->next;
+    }
+}
+
+void IncFreeSegRoom( void )
+/********************************/
+{
+    inc_seg_room    *room;
+
+    while( (room = IncSegRoom) != NULL ) {
+        IncSegRoom = room->next;
+        _LnkFree( room );
+    }
+    IncSegRoomTail = &IncSegRoom;
+}
+
 static void DoAllocateSegment( segdata *sdata, char *clname )
 /***********************************************************/
 {
     section         *sect;
     class_entry     *class;
     bool            isovlclass;
+    offset          reallen;
 
     isovlclass = FALSE;
     if( FmtData.type & MK_OVERLAYS ) {
@@ -437,12 +551,19 @@ static void DoAllocateSegment( segdata *sdata, char *clname )
         }
     }
     class = FindClass( sect, clname, sdata->is32bit, sdata->iscode );
+    reallen = sdata->length;
+    if( CanPadSegment( sdata, class ) ) {
+        sdata->length = IncSegLength( sdata, clname );
+    }
     AddSegment( sdata, class );
     if( isovlclass ) {
         sdata->u.leader->info |= SEG_OVERLAYED;
     }
     if( !sdata->isdead && !sdata->isuninit && !sdata->iscdat ) {
         sdata->data = AllocStg( sdata->length );
+        if( sdata->length > reallen ) {
+            PadCode( sdata->data + reallen, sdata->length - reallen );
+        }
     }
 }
 
@@ -279,7 +279,6 @@ static void PrepSymbol( void *_sym, void *info )
         *((unsigned_32 *)sym) = CARVE_INVALID_INDEX;
         return;
     }
-    sym->hash = CarveGetIndex( CarveSymbol, sym->hash );
     sym->link = CarveGetIndex( CarveSymbol, sym->link );
     sym->publink = CarveGetIndex( CarveSymbol, sym->publink );
     if( sym->info & SYM_IS_ALTDEF ) {
@@ -751,7 +750,6 @@ static void RebuildSymbol( void *_sym, void *info )
         CarveInsertFree( CarveSymbol, sym );
         return;
     }
-    sym->hash = CarveMapIndex( CarveSymbol, sym->hash );
     sym->link = CarveMapIndex( CarveSymbol, sym->link );
     sym->publink = CarveMapIndex( CarveSymbol, sym->publink );
     sym->name = MapString( sym->name );
@@ -37,6 +37,9 @@
 #include <unistd.h>
 #include <termios.h>
 #include <sys/stat.h>
+#if defined( __LINUX__ )
+#include <sys/mman.h>
+#endif
 #ifdef __WATCOMC__
 #include <process.h>
 #endif
@@ -207,6 +210,50 @@ unsigned QRead( f_handle file, void *buffer, unsigned len, char *name )
     return( h );
 }
 
+void *QReadAhead( f_handle file, void *buffer, unsigned long len )
+/***********************************************************************/
+/* no threads here, so the caller has to read the file itself */
+{
+    file = file; buffer = buffer; len = len;
+    return( NULL );
+}
+
+bool QReadAheadWait( void *req )
+/*************************************/
+{
+    req = req;
+    return( FALSE );
+}
+
+void *QMapFile( f_handle file, unsigned long len )
+/*******************************************************/
+/* map the whole file into memory, NULL if it can't be done */
+{
+#if defined( __LINUX__ )
+    void    *addr;
+
+    /* private and writable, so that the few places which patch the
+     * records in place only touch their own copy of the page */
+    addr = mmap( NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0 );
+    if( addr == MAP_FAILED )
+        return( NULL );
+    return( addr );
+#else
+    file = file; len = len;
+    return( NULL );
+#endif
+}
+
+void QUnmapFile( void *addr, unsigned long len )
+/*****************************************************/
+{
+#if defined( __LINUX__ )
+    munmap( addr, len );
+#else
+    addr = addr; len = len;
+#endif
+}
+
 unsigned QWrite( f_handle file, void *buffer, unsigned len, char *name )
 /*****************************************************************************/
 {
@@ -275,6 +322,16 @@ unsigned long QPos( f_handle file )
     return( lseek( file, 0L, SEEK_CUR ) );
 }
 
+bool QTruncate( f_handle file, char *name )
+/************************************************/
+/* cut the file off at the current position */
+{
+    if( ftruncate( file, lseek( file, 0L, SEEK_CUR ) ) == 0 )
+        return( TRUE );
+    LnkMsg( ERR+MSG_IO_PROBLEM, "12", name, strerror( errno ) );
+    return( FALSE );
+}
+
 unsigned long QFileSize( f_handle file )
 /*********************************************/
 {
@@ -435,6 +435,7 @@ static void ProcessMods( void )
 static void FreeModSegments( mod_entry *mod )
 /*******************************************/
 {
+    IncSaveSegRoom( mod );
     mod->publist = NULL;
     Ring2CarveFree( CarveSegData, &mod->segs );
 }
@@ -455,6 +456,7 @@ static void IncLoadObjFiles( void )
     IncIterateMods( Root->mods, FreeModSegments, TRUE );
     IncIterateMods( LibModules, FreeModSegments, TRUE );
     ProcessMods();
+    IncFreeSegRoom();
     DoIncGroupDefs();
     DoIncLibDefs();
 }
@@ -467,6 +469,7 @@ void LoadObjFiles( section *sect )
     CurrSect = sect;
     CurrMod = NULL;
     for( list = sect->files; list != NULL; list = list->next_file ) {
+        CacheReadAhead( list );
         DoPass1( NULL, list );
     }
 }
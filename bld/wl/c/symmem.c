@@ -184,7 +184,6 @@ static void * AllocBlock( unsigned size, block_data *block )
 void BasicInitSym( symbol *sym )
 /*************************************/
 {
-    sym->hash = NULL;
     sym->link = NULL;
     sym->publink = NULL;
     sym->addr.off = 0;
@@ -150,6 +150,35 @@ extern unsigned QRead( f_handle file, void *buffer, unsigned len, char *name )
     return( h );
 }
 
+extern void *QReadAhead( f_handle file, void *buffer, unsigned long len )
+/***********************************************************************/
+/* no threads here, so the caller has to read the file itself */
+{
+    file = file; buffer = buffer; len = len;
+    return( NULL );
+}
+
+extern bool QReadAheadWait( void *req )
+/*************************************/
+{
+    req = req;
+    return( FALSE );
+}
+
+extern void *QMapFile( f_handle file, unsigned long len )
+/*******************************************************/
+/* no memory mapped files here, the caller has to read the file itself */
+{
+    file = file; len = len;
+    return( NULL );
+}
+
+extern void QUnmapFile( void *addr, unsigned long len )
+/*****************************************************/
+{
+    addr = addr; len = len;
+}
+
 static unsigned TestWrite( f_handle file, void *buffer, unsigned len, char *name )
 /*****************************************************************************/
 {
@@ -237,6 +266,19 @@ extern unsigned long QPos( f_handle file )
     return( pos );
 }
 
+extern bool QTruncate( f_handle file, char *name )
+/************************************************/
+/* cut the file off at the current position (a zero length write does it) */
+{
+    int     h;
+
+    h = DosWriteFile( 0, NULL, file );
+    if( h >= 0 )
+        return( TRUE );
+    LnkMsg( ERR+MSG_IO_PROBLEM, "12", name, QErrMsg( -h ) );
+    return( FALSE );
+}
+
 extern unsigned long QFileSize( f_handle file )
 /*********************************************/
 {
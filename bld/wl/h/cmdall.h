@@ -92,6 +92,7 @@ extern bool     ProcMaxErrors( void );
 extern bool     ProcNoCaseExact( void );
 extern bool     ProcNoCache( void );
 extern bool     ProcCache( void );
+extern bool     ProcReadAhead( void );
 extern bool     ProcMangledNames( void );
 extern bool     ProcOpResource( void );
 extern bool     ProcStatics( void );
@@ -67,12 +67,17 @@ extern f_handle         ExeCreate( char * );
 extern f_handle         ExeOpen( char * );
 extern int              ResOpen( const char *name, int access, ... );
 extern unsigned         QRead( f_handle, void *, unsigned, char * );
+extern void *           QReadAhead( f_handle, void *, unsigned long );
+extern bool             QReadAheadWait( void * );
+extern void *           QMapFile( f_handle, unsigned long );
+extern void             QUnmapFile( void *, unsigned long );
 extern unsigned         QWrite( f_handle, void *, unsigned, char * );
 extern void             QWriteNL( f_handle, char * );
 extern void             QClose( f_handle, char * );
 extern long             QLSeek( f_handle, long, int, char * );
 extern void             QSeek( f_handle, long, char * );
 extern unsigned long    QPos( f_handle );
+extern bool             QTruncate( f_handle, char * );
 extern unsigned long    QFileSize( f_handle );
 extern void             QDelete( char * );
 extern bool             QReadStr( f_handle, char *, unsigned, char * );
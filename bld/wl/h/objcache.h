@@ -30,6 +30,7 @@
 ****************************************************************************/
 
 
+extern void     CacheReadAhead( file_list * );
 extern bool     CacheOpen( file_list * );
 extern void     CacheClose( file_list *, unsigned );
 extern void *   CachePermRead( file_list *, unsigned long, unsigned );
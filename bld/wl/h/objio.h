@@ -32,6 +32,9 @@
 
 extern infilelist *     CachedFiles;
 extern infilelist *     CachedLibFiles;
+extern unsigned         ReadAheadFiles;
+
+#define MAX_READ_AHEAD  4   // files read ahead at once, see MAX_OPEN_FILES
 
 extern void             InitObjIO( void );
 extern infilelist *     AllocFileEntry( char *, path_entry * );
@@ -54,6 +54,8 @@ typedef struct cdat_info {
 
 extern void             P1Start( void );
 extern unsigned long    IncPass1( void );
+extern void             IncSaveSegRoom( mod_entry * );
+extern void             IncFreeSegRoom( void );
 extern void             DoIncGroupDefs( void );
 extern void             Set32BitMode( void );
 extern void             Set16BitMode( void );
@@ -95,6 +95,7 @@ typedef struct outfilelist {
     unsigned        ovlfnoff;   // offset of filename from _OVLTAB
     bool            is_exe;     // executable flag (for file permissions)
     unsigned long   origin;
+    char            *oldbuf;    // INC: old contents when updating in place
 } outfilelist;
 
 enum infile_flags {
@@ -106,7 +107,8 @@ enum infile_flags {
     INSTAT_FULL_CACHE   = 0x0020,       // read entire file.
     INSTAT_PAGE_CACHE   = 0x0040,       // read in "paged"
     INSTAT_GOT_MODTIME  = 0x0080,
-    INSTAT_NO_WARNING   = 0x0100
+    INSTAT_NO_WARNING   = 0x0100,
+    INSTAT_MAPPED       = 0x0200        // cache is a memory mapped file
 };
 
 #define INSTAT_SET_CACHE (INSTAT_FULL_CACHE | INSTAT_PAGE_CACHE)
@@ -116,6 +118,7 @@ typedef struct infilelist {
     PATH_ENTRY          *path_list;
     char                *prefix;
     void                *cache;  // used when object file cached in mem
+    void                *readahead; // set while cache is being read ahead
     unsigned long       len;     // length of the file.
     unsigned long       currpos; // current position of the file.
     f_handle            handle;
@@ -182,7 +182,6 @@ typedef struct {
 } dos_sym_data;
 
 typedef struct symbol {
-    struct symbol       *hash;
     struct symbol       *publink;
     struct symbol       *link;
     targ_addr           addr;
@@ -278,6 +278,7 @@ STATIC char *procFlags( char const * const *argv, const char **log_name )
                 case 'z':   Glob.hold      = TRUE;  break;
                     /* these options require a filename */
                 case 'f':
+                case 'g':
                 case 'l':
                     if( ( p = *++argv ) == NULL ) {
                         PrtMsg( ERR | INVALID_FILE_OPTION, select, option );
@@ -295,6 +296,8 @@ STATIC char *procFlags( char const * const *argv, const char **log_name )
                         new->name = (char *)p;
                         new->next = filesToDo;
                         filesToDo = new;
+                    } else if( option == 'g' ) {
+                        AutoDepUseDB( p );
                     } else
                         *log_name = p;
                     break;
@@ -306,6 +309,19 @@ STATIC char *procFlags( char const * const *argv, const char **log_name )
                 options[(option | 0x20) + 1] = TRUE;
                 continue;
             }
+            if( option == 'j' && p[2] >= '0' && p[2] <= '9' ) {
+                /* -j<n>: a plain -j is the (hidden) RCS time stamp option */
+                char            *end;
+                unsigned long   jobs;
+
+                jobs = strtoul( p + 2, &end, 10 );
+                if( *end != NULLCHAR || jobs == 0 || jobs > MAX_JOBS ) {
+                    PrtMsg( ERR | INVALID_OPTION, select, option );
+                    Usage();
+                }
+                Glob.jobs = (UINT16)jobs;
+                continue;
+            }
             if( p[3] == NULLCHAR ) {
                 if( option == 'm'  && tolower( p[2] ) == 's' ) {
                     Glob.microsoft = TRUE;
@@ -355,6 +371,7 @@ STATIC char *procFlags( char const * const *argv, const char **log_name )
             if( options[opt_index + 1] ) {
                 switch( opt_index ) {
                 case 'f':
+                case 'g':
                 case 'n':
                     break;
                 case 'l':
@@ -606,6 +623,9 @@ int ExitSafe( int rc )
         }
 #endif
 
+#ifdef __UNIX__
+        WaitForJobs();
+#endif
         AutoDepFini();
         ExecFini();
         LexFini();
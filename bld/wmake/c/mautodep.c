@@ -28,9 +28,18 @@
 *
 ****************************************************************************/
 
+#include <string.h>
+#ifdef __UNIX__
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <unistd.h>
+    #include <sys/types.h>
+    #include <sys/stat.h>
+#endif
 
 #include "make.h"
 #include "mcache.h"
+#include "mhash.h"
 #include "mmemory.h"
 #include "mrcmsg.h"
 #include "msg.h"
@@ -52,6 +61,288 @@ static auto_dep_info const *AutoDepTypes[] = {
     NULL
 };
 
+#ifdef __UNIX__
+/*
+ * The .AUTODEPEND database (-g <file>).  Opening every object file to read
+ * its dependency info again on each run is what makes a make that has
+ * nothing to do slow on a big tree.  So the dependencies found in a file
+ * are kept in the database together with the file's mtime, inode and size,
+ * and as long as those still match, the file need not be opened.  The
+ * database is read when it is first needed and written back on exit.
+ */
+typedef struct adbDep {
+    struct adbDep   *next;
+    time_t          time;       /* time stamp recorded in the auto-depend info */
+    char            name[1];
+} ADBDEP;
+
+typedef struct adbFile {
+    HASHNODE        node;       /* node.name is the name of the file */
+    time_t          mtime;      /* stat() info of the file           */
+    unsigned long   ino;
+    unsigned long   size;
+    BOOLEAN         hasinfo;    /* was there any auto-depend info?   */
+    BOOLEAN         used;       /* looked at during this run         */
+    ADBDEP          *deps;      /* in the order found in the file    */
+} ADBFILE;
+
+#define ADB_HASH_PRIME  4093
+#define ADB_SIGNATURE   "WMAKE autodep 1"
+
+STATIC const char   *adbName;       /* NULL unless -g was given             */
+STATIC HASHTAB      *adbTab;        /* NULL until the database has been read */
+STATIC pid_t        adbOwner;       /* only the process that read it writes  */
+STATIC BOOLEAN      adbChanged;
+
+
+STATIC ADBDEP *adbNewDep( const char *name, time_t time )
+/*******************************************************/
+{
+    ADBDEP  *dep;
+
+    dep = MallocSafe( sizeof( *dep ) + strlen( name ) );
+    dep->next = NULL;
+    dep->time = time;
+    strcpy( dep->name, name );
+    return( dep );
+}
+
+
+STATIC void adbFreeDeps( ADBFILE *file )
+/**************************************/
+{
+    ADBDEP  *dep;
+
+    while( (dep = file->deps) != NULL ) {
+        file->deps = dep->next;
+        FreeSafe( dep );
+    }
+}
+
+
+STATIC ADBFILE *adbNewFile( const char *name )
+/********************************************/
+{
+    ADBFILE *file;
+
+    file = CallocSafe( sizeof( *file ) );
+    file->node.name = StrDupSafe( name );
+    AddHashNode( adbTab, (HASHNODE *)file );
+    return( file );
+}
+
+
+STATIC char *adbLine( char *buff, size_t len, FILE *fp )
+/*******************************************************
+ * read a line, return NULL at EOF or if the line is too long
+ */
+{
+    size_t  n;
+
+    if( fgets( buff, len, fp ) == NULL ) {
+        return( NULL );
+    }
+    n = strlen( buff );
+    if( n == 0 || buff[n - 1] != '\n' ) {
+        return( NULL );
+    }
+    buff[n - 1] = NULLCHAR;
+    return( buff );
+}
+
+
+STATIC void adbRead( void )
+/**************************
+ * read the database; a damaged one is thrown away - it is only a cache
+ */
+{
+    FILE        *fp;
+    char        buff[_MAX_PATH + 80];
+    char        *p;
+    char        *end;
+    ADBFILE     *file;
+    ADBDEP      **owner;
+    ADBDEP      *dep;
+    time_t      time;
+    BOOLEAN     ok;
+
+    adbTab = NewHashTab( ADB_HASH_PRIME );
+    adbOwner = getpid();
+    fp = fopen( adbName, "r" );
+    if( fp == NULL ) {
+        return;
+    }
+    ok = adbLine( buff, sizeof( buff ), fp ) != NULL
+        && strcmp( buff, ADB_SIGNATURE ) == 0;
+    file = NULL;
+    owner = NULL;
+    while( ok && (p = adbLine( buff, sizeof( buff ), fp )) != NULL ) {
+        ok = FALSE;
+        if( p[0] == 'F' && p[1] == ' ' ) {
+            file = CallocSafe( sizeof( *file ) );
+            file->mtime = (time_t)strtol( p + 2, &end, 10 );
+            file->ino = strtoul( end, &end, 10 );
+            file->size = strtoul( end, &end, 10 );
+            file->hasinfo = (BOOLEAN)strtoul( end, &end, 10 );
+            if( *end == ' ' && end[1] != NULLCHAR ) {
+                file->node.name = StrDupSafe( end + 1 );
+                AddHashNode( adbTab, (HASHNODE *)file );
+                owner = &file->deps;
+                ok = TRUE;
+            } else {
+                FreeSafe( file );
+            }
+        } else if( p[0] == 'D' && p[1] == ' ' && owner != NULL ) {
+            time = (time_t)strtol( p + 2, &end, 10 );
+            if( *end == ' ' && end[1] != NULLCHAR ) {
+                dep = adbNewDep( end + 1, time );
+                *owner = dep;
+                owner = &dep->next;
+                ok = TRUE;
+            }
+        }
+    }
+    if( !ok || !feof( fp ) ) {
+        adbChanged = TRUE;      /* write a good one on exit */
+    }
+    fclose( fp );
+}
+
+
+STATIC BOOLEAN adbWriteFile( void *node, void *ptr )
+/***************************************************
+ * write one file to the database; drop it if it has gone
+ */
+{
+    ADBFILE     *file = node;
+    FILE        *fp = ptr;
+    ADBDEP      *dep;
+
+    if( !file->used && access( file->node.name, 0 ) != 0 ) {
+        return( FALSE );
+    }
+    fprintf( fp, "F %ld %lu %lu %u %s\n", (long)file->mtime, file->ino,
+        file->size, (unsigned)file->hasinfo, file->node.name );
+    for( dep = file->deps; dep != NULL; dep = dep->next ) {
+        fprintf( fp, "D %ld %s\n", (long)dep->time, dep->name );
+    }
+    return( FALSE );
+}
+
+
+STATIC BOOLEAN adbFreeFile( void *node, void *ptr )
+/**************************************************/
+{
+    (void)ptr; // Unused
+    adbFreeDeps( node );
+    FreeSafe( ((ADBFILE *)node)->node.name );
+    FreeSafe( node );
+    return( FALSE );
+}
+
+
+STATIC void adbFini( void )
+/**************************
+ * write the database (if we own it and it has changed) and free it
+ */
+{
+    FILE        *fp;
+    char        *tmp_name;
+
+    if( adbTab == NULL ) {
+        return;
+    }
+    if( adbChanged && adbOwner == getpid() ) {
+        /* write a new one and rename it, so nobody sees half a database */
+        tmp_name = MallocSafe( strlen( adbName ) + 5 );
+        FmtStr( tmp_name, "%s.tmp", adbName );
+        fp = fopen( tmp_name, "w" );
+        if( fp != NULL ) {
+            fprintf( fp, "%s\n", ADB_SIGNATURE );
+            WalkHashTab( adbTab, adbWriteFile, fp );
+            if( fclose( fp ) == 0 ) {
+                rename( tmp_name, adbName );
+            } else {
+                remove( tmp_name );
+            }
+        }
+        FreeSafe( tmp_name );
+    }
+    WalkHashTab( adbTab, adbFreeFile, NULL );
+    FreeHashTab( adbTab );
+    adbTab = NULL;
+}
+
+
+STATIC ADBFILE *adbLookup( const char *name )
+/********************************************
+ * get the auto-depend info of file name, from the database if it is still
+ * good, otherwise from the file itself.  NULL if the file doesn't exist.
+ */
+{
+    struct stat                 buf;
+    ADBFILE                     *file;
+    auto_dep_info const * const *pcurr;
+    auto_dep_info const         *curr;
+    void                        *hdl;
+    void                        *dep;
+    ADBDEP                      **owner;
+    char                        *dep_name;
+    time_t                      dep_time;
+
+    if( adbTab == NULL ) {
+        adbRead();
+    }
+    if( stat( name, &buf ) != 0 ) {
+        return( NULL );
+    }
+    file = (ADBFILE *)FindHashNode( adbTab, name, TRUE );
+    if( file != NULL ) {
+        file->used = TRUE;
+        if( file->mtime == buf.st_mtime
+          && file->ino == (unsigned long)buf.st_ino
+          && file->size == (unsigned long)buf.st_size ) {
+            return( file );
+        }
+        adbFreeDeps( file );
+    } else {
+        file = adbNewFile( name );
+        file->used = TRUE;
+    }
+    file->mtime = buf.st_mtime;
+    file->ino = (unsigned long)buf.st_ino;
+    file->size = (unsigned long)buf.st_size;
+    file->hasinfo = FALSE;
+    adbChanged = TRUE;
+
+    owner = &file->deps;
+    for( pcurr = &AutoDepTypes[0]; (curr = *pcurr) != NULL; pcurr++ ) {
+        if( (hdl = curr->init_file( name )) != NULL ) {
+            file->hasinfo = TRUE;
+            for( dep = curr->first_dep( hdl ); dep != NULL; dep = curr->next_dep( hdl ) ) {
+                curr->trans_dep( dep, &dep_name, &dep_time );
+                *owner = adbNewDep( dep_name, dep_time );
+                owner = &(*owner)->next;
+            }
+            curr->fini_file( hdl );
+            break;
+        }
+    }
+    return( file );
+}
+#endif
+
+
+void AutoDepUseDB( const char *name )
+/***********************************/
+{
+#ifdef __UNIX__
+    adbName = name;
+#else
+    (void)name; // Unused
+#endif
+}
+
 
 void AutoDepInit( void )
 /**********************/
@@ -68,17 +359,14 @@ void AutoDepInit( void )
 
 static BOOLEAN isTargObsolete( char const *name, time_t stamp,
     BOOLEAN (*chk)( time_t, time_t ), time_t *pmax_time,
-    auto_dep_info const *curr, void *dep )
+    char const *dep_name, time_t auto_dep_time )
 /************************************************************/
 {
-    char        *dep_name;
-    time_t      auto_dep_time;  // time stamp in auto-depend info
     time_t      curr_dep_time;  // time stamp in dependent file (if it exists)
     BOOLEAN     exists;
     BOOLEAN     obsolete;
 
     exists = TRUE, obsolete = FALSE;
-    curr->trans_dep( dep, &dep_name, &auto_dep_time );
     if( CacheTime( dep_name, &curr_dep_time ) != RET_SUCCESS ) {
         exists = FALSE, obsolete = TRUE;
     } else {
@@ -119,17 +407,38 @@ BOOLEAN AutoDepCheck( char *name, time_t stamp,
     void                        *hdl;
     void                        *dep;
     BOOLEAN                     obs;
+    char                        *dep_name;
+    time_t                      dep_time;
 
     quick_logic = !(Glob.rcs_make | Glob.debug | Glob.show_offenders);
     obs = FALSE;
 
+#ifdef __UNIX__
+    if( adbName != NULL ) {
+        ADBFILE     *file;
+        ADBDEP      *adep;
+
+        file = adbLookup( name );
+        if( file == NULL || !file->hasinfo ) {
+            return( FALSE );
+        }
+        for( adep = file->deps; adep != NULL; adep = adep->next ) {
+            obs |= isTargObsolete( name, stamp, chk, pmax_time, adep->name, adep->time );
+            if( obs && quick_logic ) {
+                break; // No need to calculate real max time
+            }
+        }
+        return( obs );
+    }
+#endif
     for( pcurr = &AutoDepTypes[0]; (curr = *pcurr) != NULL; pcurr++ ) {
         if( (hdl = curr->init_file( name )) != NULL ) {
             dep_handle (* const first_dep)( handle )    = curr->first_dep;
             dep_handle (* const next_dep)( dep_handle ) = curr->next_dep;
 
             for( dep = first_dep( hdl ); dep != NULL; dep = next_dep( hdl ) ) {
-                obs |= isTargObsolete(name, stamp, chk, pmax_time, curr, dep );
+                curr->trans_dep( dep, &dep_name, &dep_time );
+                obs |= isTargObsolete( name, stamp, chk, pmax_time, dep_name, dep_time );
                 if( obs && quick_logic ) {
                     break; // No need to calculate real max time
                 }
@@ -147,6 +456,9 @@ void AutoDepFini( void )
 {
     const auto_dep_info * const *pcurr;
 
+#ifdef __UNIX__
+    adbFini();
+#endif
     for( pcurr = &AutoDepTypes[0]; *pcurr != NULL; pcurr++ ) {
         if( (*pcurr)->fini != NULL ) {
             (*pcurr)->fini();
@@ -405,6 +405,63 @@ STATIC enum cacheRet maybeCache( const char *fullpath, CENTRYPTR *pc )
 #pragma off(check_stack);
 #endif
 
+#else
+
+/*
+ * UNIX hosts cache directories well enough themselves, but a big makefile
+ * asks about the same files (headers listed in the .AUTODEPEND info of
+ * every object, say) over and over, and each question costs a stat().
+ * So we remember the answers until the cache is released, which happens
+ * whenever a command has been executed.
+ */
+typedef struct statEntry {
+    HASHNODE    node;           /* node.name is the full path           */
+    time_t      st_tt;          /* st_mtime of the file                 */
+    BOOLEAN     st_exists;      /* does the file exist?                 */
+} STATENTRY;
+
+#define STAT_HASH_PRIME     1021
+
+STATIC HASHTAB  *statTab;
+
+
+STATIC STATENTRY *cacheStat( const char *fullpath )
+/**************************************************
+ * find fullpath in the cache, stat() it if it isn't there yet
+ */
+{
+    STATENTRY   *sentry;
+    struct stat buf;
+
+    if( statTab == NULL ) {
+        statTab = NewHashTab( STAT_HASH_PRIME );
+    }
+    sentry = (STATENTRY *)FindHashNode( statTab, fullpath, TRUE );
+    if( sentry == NULL ) {
+        sentry = MallocSafe( sizeof( *sentry ) );
+        sentry->node.name = StrDupSafe( fullpath );
+        if( stat( fullpath, &buf ) == 0 ) {
+            sentry->st_exists = TRUE;
+            sentry->st_tt = buf.st_mtime;
+        } else {
+            sentry->st_exists = FALSE;
+            sentry->st_tt = 0;
+        }
+        AddHashNode( statTab, (HASHNODE *)sentry );
+    }
+    return( sentry );
+}
+
+
+STATIC BOOLEAN freeStat( void *node, void *ptr )
+/***********************************************/
+{
+    (void)ptr; // Unused
+    FreeSafe( ((STATENTRY *)node)->node.name );
+    FreeSafe( node );
+    return( FALSE );
+}
+
 #endif
 
 /*
@@ -435,6 +492,12 @@ void CacheRelease( void )
     cacheHead = NULL;
     MemShrink();
     CACHE_DELAY_RELEASE();
+#else
+    if( statTab != NULL ) {
+        WalkHashTab( statTab, freeStat, NULL );
+        FreeHashTab( statTab );
+        statTab = NULL;
+    }
 #endif
 }
 
@@ -444,14 +507,12 @@ void CacheFini( void )
  * Called while the program is exiting
  */
 {
-#if !defined( __UNIX__ )
-#ifdef CACHE_STATS
+#if !defined( __UNIX__ ) && defined( CACHE_STATS )
     Glob.cachestat = 0;
 #endif
 #ifndef NDEBUG
     CacheRelease();
 #endif
-#endif
 }
 
 
@@ -485,10 +546,11 @@ RET_T CacheTime( const char *fullpath, time_t *ptime )
 
         return( regStat( fullpath, ptime ) );
 #else
-        struct stat buf;
+        STATENTRY   *sentry;
 
-        if( stat( fullpath, &buf ) == 0 ) {
-            *ptime = buf.st_mtime;
+        sentry = cacheStat( fullpath );
+        if( sentry->st_exists ) {
+            *ptime = sentry->st_tt;
             return( RET_SUCCESS );
         }
 
@@ -520,7 +582,9 @@ BOOLEAN CacheExists( const char *fullpath )
             return( FALSE );
         }
     }
-#endif
 
     return( access( fullpath, 0 ) == 0 );
+#else
+    return( cacheStat( fullpath )->st_exists );
+#endif
 }
@@ -2113,6 +2113,93 @@ RET_T ExecCList( CLIST *clist )
 }
 
 
+#ifdef __UNIX__
+STATIC BOOLEAN lineDetachable( char *line )
+/******************************************
+ * can line be executed by a child wmake without losing its effect?
+ */
+{
+    char        *p;
+    char        cmdname[COM_MAX_LEN];
+    size_t      len;
+    int         comnum;
+
+    p = line;
+    for( ;; ) {
+        p = SkipWS( p );
+        if( *p != '@' && *p != '*' && *p != '!' && *p != '-' ) {
+            break;
+        }
+        ++p;
+    }
+    for( len = 0; p[len] != NULLCHAR && !isws( p[len] ); ++len ) {
+        if( len == COM_MAX_LEN - 1 ) {
+            return( TRUE );         /* too long for an internal command */
+        }
+        cmdname[len] = p[len];
+    }
+    cmdname[len] = NULLCHAR;
+    if( cmdname[0] == '%' ) {
+        /* %make updates our targets, the others end this wmake */
+        return( stricmp( cmdname + 1, "MAKE" ) != 0
+            && stricmp( cmdname + 1, "ABORT" ) != 0
+            && stricmp( cmdname + 1, "QUIT" ) != 0
+            && stricmp( cmdname + 1, "STOP" ) != 0 );
+    }
+    comnum = findInternal( cmdname );
+    switch( comnum ) {
+    case COM_SET:
+    case COM_CD:
+    case COM_CHDIR:
+    case COM_FOR:       /* may contain any of the above */
+    case COM_IF:
+        return( FALSE );
+    }
+    return( TRUE );
+}
+
+
+BOOLEAN ExecCListDetachable( CLIST *clist )
+/******************************************
+ * can clist be executed by a child wmake (see -j)?  Not if it uses inline
+ * files (we must delete them on exit) or commands that change our state
+ */
+{
+    char    *line;
+    BOOLEAN ok;
+
+    assert( clist != NULL );
+
+    for( ; clist != NULL; clist = clist->next ) {
+        if( clist->inlineHead != NULL ) {
+            return( FALSE );
+        }
+        UnGetCH( STRM_MAGIC );
+        InsString( clist->text, FALSE );
+        line = DeMacro( STRM_MAGIC );
+        GetCHR();        /* eat STRM_MAGIC */
+        ok = lineDetachable( line );
+        FreeSafe( line );
+        if( !ok ) {
+            /* don't expand any further, the remaining lines may depend on it */
+            return( FALSE );
+        }
+    }
+    return( TRUE );
+}
+
+
+void ExecChildInit( void )
+/*************************
+ * we are a child wmake about to run a command list for our parent;
+ * the parent owns the files in noKeepList
+ */
+{
+    noKeepList = NULL;
+}
+#endif
+
+
 STATIC void destroyNKList( void )
 /********************************
  * deletes the file specified in the nokeeplist
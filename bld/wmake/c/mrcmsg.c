@@ -101,7 +101,11 @@ WResSetRtns( open, close, read, write, resSeek, tell, malloc, free );
 int MsgInit( void )
 /************************/
 {
-#ifndef BOOTSTRAP
+#ifdef BOOTSTRAP
+    /* wmake.msg isn't in resource id order, but MsgGet() bsearch()es */
+    qsort( StringTable, _arraysize( StringTable ), sizeof( StringTable[0] ),
+           compar );
+#else
     int         initerror;
     static char name[_MAX_PATH]; // static because address passed outside.
 
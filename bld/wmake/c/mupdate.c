@@ -34,6 +34,12 @@
 #include <string.h>
 #include <time.h>
 #include <utime.h>
+#ifdef __UNIX__
+    #include <stdio.h>
+    #include <errno.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+#endif
 
 #include "make.h"
 #include "macros.h"
@@ -196,37 +202,74 @@ STATIC void getDate( TARGET *targ )
 #ifdef __WATCOMC__
 #pragma on (check_stack);
 #endif
+STATIC void cmdsDone( TARGET *targ, time_t max_time )
+/****************************************************
+ * the command list for targ has been carried out successfully
+ */
+{
+    struct utimbuf      times;
+    char                buffer[_MAX_PATH];
+
+    if( Glob.rcs_make && !Glob.noexec && !Glob.touch ) {
+        if( max_time != OLDEST_DATE ) {
+            targ->date = max_time;
+            targ->backdated = TRUE;
+            if( TrySufPath( buffer, targ->node.name, NULL, FALSE ) == RET_SUCCESS ) {
+                if( USE_AUTO_DEP( targ ) ) {
+                    // target has auto dependency info
+                    // result: max_time may be incorrect!
+                    CacheRelease();
+                    checkForAutoDeps( targ, buffer, &max_time );
+                }
+                times.actime = max_time;
+                times.modtime = max_time;
+                utime( buffer, &times );
+                CacheRelease();
+            }
+        }
+    }
+    targ->cmds_done = TRUE;
+}
+
+
+STATIC void cmdsFailed( TARGET *targ )
+/*************************************
+ * the command list for targ returned a bad status and the user has been
+ * told so; run the .ERROR commands or get rid of the damaged target
+ */
+{
+    CLIST   *err;
+
+    CacheRelease();     /* the commands may have got part of the way */
+    err = DotCList( DOT_ERROR );
+    if( err != NULL ) {
+        ++cListCount;
+        if( ExecCList( err ) != RET_SUCCESS ) {
+            PrtMsg( FTL | S_COMMAND_RET_BAD, DotNames[DOT_ERROR] );
+        }
+    } else if( !(targ->attr.prec || targ->attr.symb) ) {
+        if( !Glob.hold && targExists( targ ) ) {
+            if( Glob.erase || GetYes( SHOULD_FILE_BE_DELETED ) ) {
+                if( unlink( targ->node.name ) != 0 ) {
+                    PrtMsg( FTL | SYSERR_DELETING_FILE, targ->node.name );
+                }
+            }
+        }
+    }
+}
+
+
 STATIC RET_T carryOut( TARGET *targ, CLIST *clist, time_t max_time )
 /******************************************************************/
 {
-    CLIST               *err;
     int                 i;
-    struct utimbuf      times;
-    char                msg[max( MAX_RESOURCE_SIZE, _MAX_PATH )];
+    char                msg[MAX_RESOURCE_SIZE];
 
     assert( targ != NULL && clist != NULL );
 
     ++cListCount;
     if( ExecCList( clist ) == RET_SUCCESS ) {
-        if( Glob.rcs_make && !Glob.noexec && !Glob.touch ) {
-            if( max_time != OLDEST_DATE ) {
-                targ->date = max_time;
-                targ->backdated = TRUE;
-                if( TrySufPath( msg, targ->node.name, NULL, FALSE ) == RET_SUCCESS ) {
-                    if( USE_AUTO_DEP( targ ) ) {
-                        // target has auto dependency info
-                        // result: max_time may be incorrect!
-                        CacheRelease();
-                        checkForAutoDeps( targ, msg, &max_time );
-                    }
-                    times.actime = max_time;
-                    times.modtime = max_time;
-                    utime( msg, &times );
-                    CacheRelease();
-                }
-            }
-        }
-        targ->cmds_done = TRUE;
+        cmdsDone( targ, max_time );
         return( RET_SUCCESS );
     }
 
@@ -245,21 +288,7 @@ STATIC RET_T carryOut( TARGET *targ, CLIST *clist, time_t max_time )
     MsgGetTail( LAST_CMD_MAKING_RET_BAD, msg );
     PrtMsg( ERR | PRNTSTR, msg );
 
-    err = DotCList( DOT_ERROR );
-    if( err != NULL ) {
-        ++cListCount;
-        if( ExecCList( err ) != RET_SUCCESS ) {
-            PrtMsg( FTL | S_COMMAND_RET_BAD, DotNames[DOT_ERROR] );
-        }
-    } else if( !(targ->attr.prec || targ->attr.symb) ) {
-        if( !Glob.hold && targExists( targ ) ) {
-            if( Glob.erase || GetYes( SHOULD_FILE_BE_DELETED ) ) {
-                if( unlink( targ->node.name ) != 0 ) {
-                    PrtMsg( FTL | SYSERR_DELETING_FILE, targ->node.name );
-                }
-            }
-        }
-    }
+    cmdsFailed( targ );
     if( Glob.cont ) {
         return( RET_WARN );
     }
@@ -271,6 +300,220 @@ STATIC RET_T carryOut( TARGET *targ, CLIST *clist, time_t max_time )
 #endif
 
 
+STATIC RET_T targMade( TARGET *targ )
+/************************************
+ * check that we have got targ now that we are through with it
+ */
+{
+    if( targExists( targ ) || targ->attr.symb || Glob.ignore ) {
+        // Target exists or it is symbolic or we're ignoring errors,
+        // therefore everyone's happy and we can charge forward
+        PrtMsg( DBG | INF | TARGET_IS_UPDATED, targ->node.name );
+    } else if( targ->cmds_done && Glob.nocheck ) {
+        // Target doesn't exist even though we processed some commands,
+        // but we're not checking existence of files. Consider it uptodate.
+        targ->existing = TRUE;
+        PrtMsg( DBG | INF | TARGET_FORCED_UPTODATE, targ->node.name );
+    } else if( Glob.cont ) {
+        // Target doesn't exist but we're forcibly continuing. Report
+        // nonfatal error.
+        PrtMsg( ERR | UNABLE_TO_MAKE, targ->node.name );
+        return( RET_ERROR );
+    } else {
+        // Target doesn't exist and we have no clue how to make it. Bomb out.
+        PrtMsg( FTL | UNABLE_TO_MAKE, targ->node.name );
+        return( RET_ERROR );
+    }
+    return( RET_SUCCESS );
+}
+
+
+#ifdef __UNIX__
+/*
+ * Parallel jobs (-j<n>): a command list which a child wmake can carry out
+ * on its own is started as a job and we go on with the other targets.  The
+ * target stays pending until its job ends, and anyone who wants to know the
+ * date of a pending target has to wait for the job first.  Whatever a job
+ * writes to stdout/stderr is collected in a temporary file and printed in
+ * one piece when the job ends, so the output of jobs never gets mixed up.
+ */
+typedef struct jobSlot {
+    pid_t       pid;        /* child wmake, 0 if the slot is free       */
+    TARGET      *targ;      /* target being made                        */
+    FILE        *out;       /* stdout/stderr of the child               */
+    time_t      max_time;   /* for cmdsDone()                           */
+} JOBSLOT;
+
+STATIC JOBSLOT  *jobSlots;      /* NULL if commands are run one by one  */
+STATIC unsigned jobsRunning;
+STATIC BOOLEAN  jobsStopping;   /* no new jobs, errors can't stop us    */
+
+STATIC void waitJob( void );
+
+
+STATIC void printJobOutput( FILE *out )
+/*************************************/
+{
+    int     fh;
+    int     len;
+    char    buffer[512];
+
+    fh = fileno( out );
+    lseek( fh, 0, SEEK_SET );
+    while( (len = read( fh, buffer, sizeof( buffer ) )) > 0 ) {
+        write( STDOUT, buffer, len );
+    }
+    fclose( out );
+}
+
+
+STATIC void endJob( JOBSLOT *job, int status )
+/*********************************************
+ * the job has terminated with status (from waitpid)
+ */
+{
+    TARGET  *targ;
+    char    msg[MAX_RESOURCE_SIZE];
+
+    targ = job->targ;
+    printJobOutput( job->out );
+    job->pid = 0;
+    --jobsRunning;
+    targ->pending = FALSE;
+    ResetExecuted();                    /* the job may have changed things */
+    CacheRelease();
+
+    if( WIFEXITED( status ) && WEXITSTATUS( status ) == EXIT_OK ) {
+        cmdsDone( targ, job->max_time );
+        if( jobsStopping || targMade( targ ) == RET_SUCCESS ) {
+            return;
+        }
+    } else {
+        PrtMsg( ERR | NEOL | LAST_CMD_MAKING_RET_BAD );
+        PrtMsg( ERR | NEOL | PRNTSTR, targ->node.name );
+        MsgGetTail( LAST_CMD_MAKING_RET_BAD, msg );
+        PrtMsg( ERR | PRNTSTR, msg );
+        cmdsFailed( targ );
+    }
+    targ->updated = FALSE;
+    targ->error = TRUE;
+    if( !Glob.cont && !jobsStopping ) {
+        /* let the other jobs finish, but don't start any new ones */
+        jobsStopping = TRUE;
+        while( jobsRunning > 0 ) {
+            waitJob();
+        }
+        exit( ExitSafe( EXIT_ERROR ) );
+    }
+}
+
+
+STATIC void waitJob( void )
+/**************************
+ * wait until one of the running jobs ends
+ */
+{
+    pid_t       pid;
+    int         status;
+    JOBSLOT     *job;
+
+    assert( jobsRunning > 0 );
+
+    for( ;; ) {
+        pid = waitpid( -1, &status, 0 );
+        if( pid == -1 ) {
+            if( errno == EINTR ) {
+                CheckForBreak();
+                continue;
+            }
+            /* our children are gone; take the first job as failed */
+            for( job = jobSlots; job->pid == 0; ++job ) {
+                ;
+            }
+            endJob( job, -1 );
+            return;
+        }
+        for( job = jobSlots; job < jobSlots + Glob.jobs; ++job ) {
+            if( job->pid == pid ) {
+                endJob( job, status );
+                return;
+            }
+        }
+    }
+}
+
+
+STATIC void waitTarget( TARGET *targ )
+/*************************************
+ * wait until targ is no longer being made by a job
+ */
+{
+    while( targ->pending ) {
+        waitJob();
+    }
+}
+
+
+STATIC RET_T startJob( TARGET *targ, CLIST *clist, time_t max_time )
+/*******************************************************************
+ * carry out clist for targ in a child wmake; don't wait for it
+ */
+{
+    JOBSLOT     *job;
+    FILE        *out;
+    pid_t       pid;
+
+    while( jobsRunning >= Glob.jobs ) {
+        waitJob();
+    }
+    out = tmpfile();
+    if( out == NULL ) {
+        return( carryOut( targ, clist, max_time ) );
+    }
+    pid = fork();
+    if( pid == -1 ) {
+        fclose( out );
+        return( carryOut( targ, clist, max_time ) );
+    }
+    if( pid == 0 ) {
+        /* the jobs of our parent are none of our business */
+        jobSlots = NULL;
+        jobsRunning = 0;
+        ExecChildInit();
+        dup2( fileno( out ), STDOUT_FILENO );
+        dup2( fileno( out ), STDERR_FILENO );
+        fclose( out );
+        _exit( ExecCList( clist ) == RET_SUCCESS ? EXIT_OK : EXIT_ERROR );
+    }
+    ++cListCount;
+    for( job = jobSlots; job->pid != 0; ++job ) {
+        ;
+    }
+    job->pid = pid;
+    job->targ = targ;
+    job->out = out;
+    job->max_time = max_time;
+    ++jobsRunning;
+    targ->pending = TRUE;
+    return( RET_SUCCESS );
+}
+
+
+void WaitForJobs( void )
+/***********************
+ * we are about to quit - wait for the running jobs
+ */
+{
+    jobsStopping = TRUE;
+    while( jobsRunning > 0 ) {
+        waitJob();
+    }
+}
+#else
+#define waitTarget( targ )
+#endif
+
+
 STATIC time_t maxDepTime( time_t max_time, DEPEND *dep )
 /******************************************************/
 {
@@ -313,6 +556,8 @@ STATIC RET_T perform( TARGET *targ, DEPEND *dep, time_t max_time )
     impliedDepend = NULL;
     assert( targ != NULL && dep != NULL );
 
+    waitTarget( targ );
+
     if( Glob.query ) {
         ++cListCount;
         return( RET_WARN );
@@ -377,7 +622,13 @@ STATIC RET_T perform( TARGET *targ, DEPEND *dep, time_t max_time )
         doneBefore = TRUE;
     }
     exPush( targ, depend, impliedDepend );
-    ret = carryOut( targ, clist, findMaxTime( targ, dep, max_time ) );
+    max_time = findMaxTime( targ, dep, max_time );
+#ifdef __UNIX__
+    if( jobSlots != NULL && !targ->attr.symb && ExecCListDetachable( clist ) ) {
+        ret = startJob( targ, clist, max_time );
+    } else
+#endif
+    ret = carryOut( targ, clist, max_time );
     exPop();
     if( dep->slistCmd != NULL ) {
         FreeCList(clist);
@@ -391,11 +642,11 @@ RET_T MakeList( TLIST *tlist )
 {
     RET_T   ret;
     TARGET  *targ;
+    TLIST   *walk;
 
     ret = RET_SUCCESS;
-    while( tlist != NULL ) {
-        targ = tlist->target;
-        tlist = tlist->next;
+    for( walk = tlist; walk != NULL; walk = walk->next ) {
+        targ = walk->target;
         if( targ->mentioned == FALSE ) {
             PrtMsg( WRN | TARGET_NOT_MENTIONED, targ->node.name );
             targ->mentioned = TRUE;
@@ -404,6 +655,18 @@ RET_T MakeList( TLIST *tlist )
             ret = RET_ERROR;
         }
     }
+#ifdef __UNIX__
+    /* all jobs for the list have been started, now see how they did */
+    for( walk = tlist; walk != NULL; walk = walk->next ) {
+        targ = walk->target;
+        if( targ->pending ) {
+            waitTarget( targ );
+            if( targ->error ) {
+                ret = RET_ERROR;
+            }
+        }
+    }
+#endif
     return( ret );
 }
 
@@ -461,6 +724,8 @@ STATIC RET_T isOutOfDate( TARGET *targ, TARGET *deptarg, BOOLEAN *outofdate )
  * Checks if the current target is out of date
  */
 {
+    waitTarget( targ );
+    waitTarget( deptarg );
     getDate( targ );
     if( targ->existing && targ->attr.existsonly ) {
         return( RET_SUCCESS );
@@ -713,6 +978,7 @@ STATIC RET_T imply( TARGET *targ, const char *drive, const char *dir,
         /* We've tried our best to make the imptarg, check if it exists
          * after our efforts.
          */
+        waitTarget( imptarg );
         if( targExists( imptarg ) ) {
             /* it exists - now we perform the implicit cmd list, and return */
             ret = implyMaybePerform( targ, imptarg, cur->cretarg, must,
@@ -849,6 +1115,7 @@ STATIC RET_T resolve( TARGET *targ, DEPEND *depend )
 
     MakeList( depend->targs );
 
+    waitTarget( targ );     /* "::" targets may have a job from another depend */
     getDate( targ );
 
     outofdate = FALSE;
@@ -894,7 +1161,6 @@ RET_T Update( TARGET *targ )
 {
     DEPEND      *curdep;
     UINT32      startcount;
-    BOOLEAN     target_exists;
     RET_T       ret;
 
     CheckForBreak();
@@ -904,6 +1170,10 @@ RET_T Update( TARGET *targ )
     if( targ->updated ) {
         return( RET_SUCCESS );
     }
+    waitTarget( targ );
+    if( targ->error ) {
+        return( RET_ERROR );
+    }
     if( targ->special ) {
         PrtMsg( FTL | ATTEMPT_MAKE_SPECIAL, targ->node.name );
     }
@@ -965,30 +1235,17 @@ RET_T Update( TARGET *targ )
         targ->date = YOUNGEST_DATE;
     }
 
-    target_exists = targExists( targ );                         /* 18-nov-91 */
-    if( target_exists || targ->attr.symb || Glob.ignore ) {
-        // Target exists or it is symbolic or we're ignoring errors,
-        // therefore everyone's happy and we can charge forward
-        PrtMsg( DBG | INF | TARGET_IS_UPDATED, targ->node.name );
-    } else {
-        // Target doesn't exist, we may be in trouble
-        if( targ->cmds_done && Glob.nocheck ) {
-            // Target doesn't exist even though we processed some commands,
-            // but we're not checking existence of files. Consider it uptodate.
-            targ->existing = TRUE;
-            PrtMsg( DBG | INF | TARGET_FORCED_UPTODATE, targ->node.name );
-        } else if( Glob.cont ) {
-            // Target doesn't exist but we're forcibly continuing. Report
-            // nonfatal error.
-            targ->error = TRUE;
-            targ->busy = FALSE;
-            PrtMsg( ERR | UNABLE_TO_MAKE, targ->node.name );
-            return( RET_ERROR );
-        } else {
-            // Target doesn't exist and we have no clue how to make it. Bomb out.
-            PrtMsg( FTL | UNABLE_TO_MAKE, targ->node.name );
-            return( RET_ERROR );
-        }
+    if( targ->pending ) {
+        /* a job is making it - endJob() will check the result */
+        targ->updated = targ->attr.multi == FALSE;
+        targ->busy = FALSE;
+        return( RET_SUCCESS );
+    }
+
+    if( targMade( targ ) != RET_SUCCESS ) {                     /* 18-nov-91 */
+        targ->error = TRUE;
+        targ->busy = FALSE;
+        return( RET_ERROR );
     }
 
     targ->updated = targ->attr.multi == FALSE;
@@ -1159,6 +1416,11 @@ void UpdateInit( void )
             &&  exStackP == 0
     );
     DoingUpdate = TRUE;
+#ifdef __UNIX__
+    if( Glob.jobs > 1 && !(Glob.noexec || Glob.query || Glob.touch) ) {
+        jobSlots = CallocSafe( Glob.jobs * sizeof( *jobSlots ) );
+    }
+#endif
 }
 
 
@@ -1169,6 +1431,15 @@ void UpdateFini( void )
 
     assert( exStackP == 0 );
 
+#ifdef __UNIX__
+    if( jobSlots != NULL ) {
+        while( jobsRunning > 0 ) {
+            waitJob();
+        }
+        FreeSafe( jobSlots );
+        jobSlots = NULL;
+    }
+#endif
     after = DotCList( DOT_AFTER );
     if( doneBefore && after != NULL ) {
         ++cListCount;
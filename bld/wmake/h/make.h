@@ -60,8 +60,11 @@
 #define STREAM_ALLOC_SENT       10
 #define VECSTR_ALLOC_VECSTR     5
 
+#define MAX_JOBS                256     /* upper limit for -j<n>             */
+
 struct Glob {
     char    swchar;     /* the 'switch' character (ie: '-' or '/' )          */
+    UINT16  jobs;       /* max number of commands run at once (-j<n>)        */
 
     BIT     all         : 1;/* make all targets                              */
     BIT     block       : 1;/* block the use of implicit rules               */
@@ -45,3 +45,4 @@ typedef struct  auto_dep_info {
 extern void     AutoDepInit( void );
 extern BOOLEAN  AutoDepCheck( char *name, time_t stamp, BOOLEAN (*chk)( time_t, time_t ), time_t *pmax );
 extern void     AutoDepFini( void );
+extern void     AutoDepUseDB( const char *name );
@@ -40,5 +40,9 @@ extern RET_T    ExecCList( CLIST *clist );
 extern int_32   ExecCommand( char *line );
 extern void     ExecInit( void );
 extern void     ExecFini( void );
+#ifdef __UNIX__
+extern BOOLEAN  ExecCListDetachable( CLIST *clist );
+extern void     ExecChildInit( void );
+#endif
 
 #endif
@@ -108,6 +108,7 @@ struct Target {
     BIT     allow_nocmd : 1;    /* allow no command list to update */
     BIT     cmds_done   : 1;    /* command list was executed to update it */
     BIT     sufsuf      : 1;    /* is this an implicit rule             */
+    BIT     pending     : 1;    /* a job is running its commands (-j)   */
 
 };
 
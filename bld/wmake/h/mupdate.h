@@ -42,6 +42,9 @@ extern void         UpdateInit( void );
 extern void         UpdateFini( void );
 extern RET_T        Update( TARGET *targ );
 extern RET_T        MakeList( TLIST *list );
+#ifdef __UNIX__
+extern void         WaitForJobs( void );
+#endif
 
 /* called by macro.c */
 extern char         *GetCurDeps( BOOLEAN younger, BOOLEAN IsMacInf );
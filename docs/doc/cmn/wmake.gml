@@ -146,10 +146,14 @@ debug mode - echo all work as it progresses
 always erase target after error/interrupt (disables prompting)
 .note &sw.f
 the next parameter is a name of dependency description file
+.note &sw.g
+the next parameter is the name of a file to keep auto-dependency information in (UNIX hosts only)
 .note &sw.h
 do not print out &maksname identification lines (no header)
 .note &sw.i
 ignore return status of all commands executed
+.note &sw.j<n>
+run up to <n> commands at the same time (UNIX hosts only)
 .note &sw.k
 on error/interrupt: continue on next target
 .note &sw.l
@@ -268,6 +272,23 @@ Any number of makefiles may be processed with the "f" option.
 &makcmd /f myfile
 &makcmd /f myfile1 /f myfile2
 .exam end
+:OPT name='g'
+.ix '&makcmdup options' 'g'
+.ix 'auto-dependency database'
+The "g" option specifies that the next parameter on the command line
+is the name of a file in which &maksname keeps the auto-dependency
+information it finds in files (UNIX hosts only).
+Without it, the auto-dependency information of every file is read again
+each time &maksname runs.
+With it, the information is read from a file only when the file has
+changed since the last time &maksname looked at it; the file is
+considered changed when its time stamp, size or inode number differ.
+The file is created if it doesn't exist and is rewritten when
+&maksname exits.
+It is only a cache, so it may be deleted at any time.
+.exam begin
+&makcmd /g .wmkdeps
+.exam end
 :OPT name='h'
 .ix '&makcmdup options' 'h'
 do not print out &maksname identification lines (no header)
@@ -286,6 +307,32 @@ ignore return status of all commands executed
 The "i" option is equivalent to the
 .id &sysper.IGNORE
 directive.
+:OPT name='j<n>'
+.ix '&makcmdup options' 'j'
+.ix 'parallel make'
+run up to <n> commands at the same time
+.np
+The "j" option, followed by a number, allows &maksname to update up to
+<n> targets at the same time on UNIX hosts.
+Once the dependents of a target are up to date, its command list is
+run by a separate process while &maksname goes on with other targets;
+a target that depends on it is not checked until the process has
+finished.
+The output of each command list is held back and displayed in one piece
+when the command list is done, so output from different targets is never
+mixed.
+Command lists that use inline files or commands which change the state
+of &maksname (such as "set", "cd", "for", "if" or "%make") are run one at
+a time as usual, as are the commands of
+.id &sysper.SYMBOLIC
+targets and the
+.id &sysper.BEFORE
+and
+.id &sysper.AFTER
+command lists.
+When a command returns a bad status, &maksname waits for the commands
+already running to finish and then stops, unless the "k" option is
+used.
 :OPT name='k'
 .ix '&makcmdup options' 'k'
 on error/interrupt: continue on next target
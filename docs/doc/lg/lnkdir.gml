@@ -211,6 +211,7 @@
 .dir protmode           opprotmo.gml    os2
 .dir pseudopreemption   oppseudo.gml    netware
 .dir quiet              opquiet.gml     all
+.dir readahead          opreadah.gml    all
 .dir redefsok           opredefs.gml    all
 .dir reentrant          opreentr.gml    netware
 .dir reference          ldrefere.gml    all
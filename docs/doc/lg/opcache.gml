@@ -50,3 +50,10 @@ However, it is not a virtual memory system.
 Caching object files can consume large amounts of memory.
 This may prevent other tasks on the system from running, a problem
 that may be solved by using the "NOCACHE" option.
+.np
+The Linux-hosted version of the linker maps object files and libraries
+into memory instead of reading them into its own buffers.
+The operating system pages the file contents in as they are used and
+can discard them again when memory is needed, so this costs neither
+page file activity nor a copy of each file.
+The "NOCACHE" option turns this off as well.
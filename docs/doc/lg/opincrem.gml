@@ -39,6 +39,14 @@ where an incremental re-link is not possible.
 The options "ELIMINATE" and "VFREMOVAL" cannot be used at the same
 time as incremental linking.
 .np
+When creating PE or ELF executables for Intel processors, the linker
+leaves some free space (filled with "nop" instructions) after the code
+of each object file.
+A module which grows by a small amount can then be linked again at the
+same address, so the rest of the executable does not move.
+The linker also updates the existing executable file in place and only
+writes those parts of it which have changed.
+.np
 It is possible, over time, to accumulate unneeded functions in the
 executable by using incremental linking.
 To guarantee an executable of minimum size, you can cause a full
@@ -0,0 +1,30 @@
+.*
+.*
+.option READAHEAD
+.*
+.np
+The "READAHEAD" option tells the &lnkname to read object files into
+memory in separate threads before they are needed.
+While the &lnkname is processing an object file, the object files that
+follow it are read, so that waiting for the disk overlaps with the
+processing of object files.
+Object files are still processed one at a time and in the order they
+were specified, so the executable file is the same as when the
+"READAHEAD" option is not used.
+.np
+The format of the "READAHEAD" option (short form "READA") is as
+follows.
+.mbigbox
+    OPTION READAHEAD=n
+.embigbox
+.synote
+.mnote n
+is the number of object files to read ahead, from 0 to 4.
+The default is 0, which means that object files are read when they are
+processed.
+.esynote
+.np
+Libraries are not read ahead and the "READAHEAD" option has no effect
+if the "NOCACHE" option is also specified.
+Only the OS/2 and Windows NT-hosted versions of the linker read
+object files ahead; the other versions ignore this option.